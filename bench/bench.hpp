@@ -0,0 +1,34 @@
+#ifndef _BENCH_HPP_
+#define _BENCH_HPP_
+
+#include <sys/time.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+/** @brief Small helpers shared by the benchmarks: a wall clock,
+ *	a result line and a sink so the optimiser keeps the measured work */
+
+static volatile long	g_bench_sink = 0;
+
+//	wall clock in microseconds
+inline long long	bench_now(void) {
+	struct timeval	time_now;
+
+	gettimeofday(&time_now, NULL);
+	return (long long)time_now.tv_sec * 1000000 + time_now.tv_usec;
+}
+
+//	prints the label, the total time and the time per operation
+inline void	bench_report(const std::string& label, long long usecs, std::size_t ops) {
+	std::cout << "  " << std::left << std::setw(40) << label
+						<< std::right << std::setw(10) << usecs / 1000.0 << " ms"
+						<< std::setw(10) << (ops ? usecs * 1000.0 / ops : 0) << " ns/op" << std::endl;
+}
+
+inline void	bench_title(const std::string& title) {
+	std::cout << std::endl << "\033[0;34m" << title << "\033[0m" << std::endl;
+}
+
+#endif
@@ -0,0 +1,933 @@
+#include <map>
+#include <sstream>
+#include <tr1/unordered_map>
+#include "bench.hpp"
+#include "../containers/map.hpp"
+#include "../containers/compact_map.hpp"
+#include "../containers/btree_map.hpp"
+#include "../containers/flat_map.hpp"
+#include "../containers/frozen_map.hpp"
+#include "../containers/persistent_map.hpp"
+#include "../containers/sharded_map.hpp"
+#include "../containers/concurrent_skiplist_map.hpp"
+#include "../containers/rcu_map.hpp"
+#include "../containers/lsm_map.hpp"
+#include "../containers/art_map.hpp"
+#include "../containers/prefix_map.hpp"
+#include "../containers/unordered_map.hpp"
+#include "../inc/string_view.hpp"
+
+typedef ft::map<int, int>																									ft_map;
+typedef ft::map<int, int, std::less<int>,
+								std::allocator<ft::pair<const int, int> >, ft::tree_policy<true> >								ft_threaded_map;
+typedef ft::map<int, int, std::less<int>,
+								ft::node_pool_allocator<ft::pair<const int, int> > >				ft_pool_map;
+typedef ft::map<int, int, std::less<int>,
+								ft::arena_allocator<ft::pair<const int, int> > >						ft_arena_map;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+								ft::tree_policy<false, ft::red_black_balance> >							ft_rb_map;
+typedef ft::compact_map<int, int>																					ft_compact_map;
+typedef ft::btree_map<int, int>																						ft_btree_map;
+typedef ft::flat_map<int, int>																						ft_flat_map;
+typedef ft::frozen_map<int, int>																					ft_frozen_map;
+typedef ft::persistent_map<int, int>																			ft_persistent_map;
+typedef ft::sharded_map<int, int>																					ft_sharded_map;
+typedef ft::lsm_map<int, int>																							ft_lsm_map;
+typedef ft::unordered_map<int, int>																				ft_unordered_map;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+								ft::tree_policy<false, ft::avl_balance, ft::order_statistics> >				ft_os_map;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+								ft::tree_policy<false, ft::avl_balance, ft::monoid_augment<ft::sum_of<long> > > >	ft_sum_map;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+								ft::tree_policy<false, ft::avl_balance, ft::monoid_augment<ft::min_of<int> > > >	ft_min_map;
+typedef ft::map<int, long, std::less<int>, std::allocator<ft::pair<const int, long> >,
+								ft::tree_policy<false, ft::avl_balance, ft::range_add<long> > >			ft_add_map;
+/** std::unordered_map is C++11: the TR1 one stands in for it */
+typedef std::tr1::unordered_map<int, int>																	tr1_unordered_map;
+
+/** fills 'm' with 'n' random keys */
+template <class Map>
+void	bench_fill(Map& m, std::size_t n) {
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(typename Map::value_type(rand(), i));
+}
+
+/** same keys as one batch: inserted one at a time a flat_map is quadratic */
+template <class K, class V>
+void	bench_fill(ft::flat_map<K, V>& m, std::size_t n) {
+	ft::vector<ft::pair<K, V> >	batch;
+	batch.reserve(n);
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		batch.push_back(ft::pair<K, V>(rand(), i));
+	m.insert(batch.begin(), batch.end());
+}
+
+/** an lsm_map takes blind writes: insert() would look every key up first */
+template <class K, class V>
+void	bench_fill(ft::lsm_map<K, V>& m, std::size_t n) {
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		m.insert_or_assign(rand(), i);
+}
+
+/** a frozen_map is built from a finished ft::map */
+template <class K, class V>
+void	bench_fill(ft::frozen_map<K, V>& m, std::size_t n) {
+	ft::map<K, V>	tree;
+	bench_fill(tree, n);
+	m = tree.freeze();
+}
+
+/** full forward and backward scans, 'rounds' times each */
+template <class Map>
+void	bench_map_scan(const std::string& label, std::size_t n, int rounds) {
+	Map	m;
+	bench_fill(m, n);
+
+	long long	start = bench_now();
+	long			sum = 0;
+	for (int r = 0; r < rounds; r++) {
+		for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+		for (typename Map::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+			sum -= it->second;
+	}
+	g_bench_sink += sum;
+	bench_report(label, bench_now() - start, 2 * rounds * m.size());
+}
+
+template <class Map>
+void	bench_reserve(Map& m, std::size_t n) { m.reserve(n); }
+
+template <class K, class V>
+void	bench_reserve(std::map<K, V>&, std::size_t) {}
+
+template <class K, class V>
+void	bench_reserve(ft::btree_map<K, V>&, std::size_t) {}
+
+template <class K, class V>
+void	bench_reserve(std::tr1::unordered_map<K, V>& m, std::size_t n) { m.rehash(n); }
+
+/** times one full forward scan */
+template <class Map>
+long long	bench_scan_once(const Map& m) {
+	long long	start = bench_now();
+	long			sum = 0;
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	g_bench_sink += sum;
+	return bench_now() - start;
+}
+
+/** insert/erase churn on keys in [0, 2n): about half the erases hit,
+ *	so the allocator keeps recycling nodes; then a scan of what is left */
+template <class Map>
+void	bench_map_churn(const std::string& label, std::size_t n, bool reserve) {
+	Map	m;
+	if (reserve)
+		bench_reserve(m, n);
+	srand(42);
+
+	long long	start = bench_now();
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(typename Map::value_type(rand() % (2 * n), i));
+	bench_report(label + " fill", bench_now() - start, n);
+
+	start = bench_now();
+	for (std::size_t i = 0; i < n; i++) {
+		m.erase(rand() % (2 * n));
+		m.insert(typename Map::value_type(rand() % (2 * n), i));
+	}
+	bench_report(label + " churn", bench_now() - start, 2 * n);
+	bench_report(label + " scan after churn", bench_scan_once(m), m.size());
+}
+
+/** 'n' lookups of keys drawn like the fill, so most of them hit */
+template <class Map>
+void	bench_map_lookup(const std::string& label, std::size_t n) {
+	Map	m;
+	bench_fill(m, n);
+
+	srand(42);
+	long long	start = bench_now();
+	long			sum = 0;
+	for (std::size_t i = 0; i < n; i++) {
+		typename Map::const_iterator it = m.find(rand());
+		if (it != m.end())
+			sum += it->second;
+	}
+	g_bench_sink += sum;
+	bench_report(label, bench_now() - start, n);
+}
+
+template <class Map>
+void	bench_compact(Map&) {}
+
+template <class K, class V>
+void	bench_compact(ft::lsm_map<K, V>& m) { m.compact(); }
+
+/** 'n' random writes, then 'n' random count()s, optionally compacting in
+ *	between (lsm_map) */
+template <class Map>
+void	bench_write_burst(const std::string& label, std::size_t n, bool compact) {
+	Map				m;
+	long long	start = bench_now();
+	bench_fill(m, n);
+	if (!compact)
+		bench_report(label + " write", bench_now() - start, n);
+	else {
+		start = bench_now();
+		bench_compact(m);
+		bench_report(label + " compact", bench_now() - start, n);
+	}
+
+	srand(43);
+	start = bench_now();
+	long	found = 0;
+	for (std::size_t i = 0; i < n; i++)
+		found += m.count(rand());
+	g_bench_sink += found;
+	bench_report(label + " count", bench_now() - start, n);
+}
+
+template <class K, class V>
+std::size_t	bench_memory(const ft::map<K, V>& m) { return m.size() * sizeof(typename ft::map<K, V>::node_type); }
+
+template <class K, class V>
+std::size_t	bench_memory(const ft::art_map<K, V>& m) { return m.memory(); }
+
+/** 'n' random 64-bit keys (xorshift64) inserted, then all looked up again;
+ *	reports the bytes the map's nodes take */
+template <class Map>
+void	bench_u64_keys(const std::string& label, std::size_t n) {
+	Map				m;
+	uint64_t	x = 88172645463325252ULL;
+	long long	start = bench_now();
+	for (std::size_t i = 0; i < n; i++) {
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		m.insert(typename Map::value_type(x, i));
+	}
+	bench_report(label + " insert", bench_now() - start, n);
+
+	x = 88172645463325252ULL;
+	start = bench_now();
+	long	sum = 0;
+	for (std::size_t i = 0; i < n; i++) {
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		sum += m.find(x)->second;
+	}
+	g_bench_sink += sum;
+	bench_report(label + " find", bench_now() - start, n);
+	std::cout << "  " << label << " memory: " << bench_memory(m) / (1024 * 1024) << " MiB, "
+						<< bench_memory(m) / m.size() << " bytes per key" << std::endl;
+}
+
+/** node bytes, plus the heap blocks of the keys too long to be stored in
+ *	the std::string itself */
+template <class V>
+std::size_t	bench_memory(const ft::map<std::string, V>& m) {
+	std::size_t	bytes = m.size() * sizeof(typename ft::map<std::string, V>::node_type);
+	for (typename ft::map<std::string, V>::const_iterator it = m.begin(); it != m.end(); ++it)
+		if (it->first.capacity() > 15)
+			bytes += it->first.capacity() + 1;
+	return bytes;
+}
+
+template <class V>
+std::size_t	bench_memory(const ft::prefix_map<V>& m) { return m.memory(); }
+
+/** how many keys start with 'prefix' */
+template <class V>
+std::size_t	bench_scan(const ft::map<std::string, V>& m, const std::string& prefix) {
+	std::size_t	count = 0;
+	for (typename ft::map<std::string, V>::const_iterator it = m.lower_bound(prefix);
+			it != m.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+		count++;
+	return count;
+}
+
+template <class V>
+std::size_t	bench_scan(const ft::prefix_map<V>& m, const std::string& prefix) {
+	std::size_t	count = 0;
+	typedef typename ft::prefix_map<V>::const_iterator	iterator;
+	for (ft::pair<iterator, iterator> range = m.scan_prefix(prefix); range.first != range.second; ++range.first)
+		count++;
+	return count;
+}
+
+/** 'n' path-like string keys sharing long prefixes, inserted then found */
+template <class Map>
+void	bench_path_keys(const std::string& label, std::size_t n) {
+	static const char*	services[4] = { "billing", "search", "storage", "auth" };
+	ft::vector<std::string>	keys;
+	keys.reserve(n);
+	srand(42);
+	for (std::size_t i = 0; i < n; i++) {
+		std::ostringstream	key;
+		key << "tenant" << rand() % 1000 << "/" << services[rand() % 4] << "/metric" << rand();
+		keys.push_back(key.str());
+	}
+	Map				m;
+	long long	start = bench_now();
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(typename Map::value_type(keys[i], i));
+	bench_report(label + " insert", bench_now() - start, n);
+	start = bench_now();
+	long	sum = 0;
+	for (std::size_t i = n; i-- > 0; )
+		sum += m.find(keys[i])->second;
+	g_bench_sink += sum;
+	bench_report(label + " find", bench_now() - start, n);
+}
+
+/** the path keys of bench_path_keys: every "tenant<t>/<service>/" scanned
+ *	for its keys, then the bytes the map holds */
+template <class Map>
+void	bench_path_scan(const std::string& label, std::size_t n) {
+	static const char*	services[4] = { "billing", "search", "storage", "auth" };
+	Map			m;
+	srand(42);
+	for (std::size_t i = 0; i < n; i++) {
+		std::ostringstream	key;
+		key << "tenant" << rand() % 1000 << "/" << services[rand() % 4] << "/metric" << rand();
+		m.insert(typename Map::value_type(key.str(), i));
+	}
+	ft::vector<std::string>	prefixes;
+	for (int t = 0; t < 1000; t++)
+		for (int s = 0; s < 4; s++) {
+			std::ostringstream	prefix;
+			prefix << "tenant" << t << "/" << services[s] << "/";
+			prefixes.push_back(prefix.str());
+		}
+	std::size_t	found = 0;
+	long long		start = bench_now();
+	for (std::size_t i = 0; i < prefixes.size(); i++)
+		found += bench_scan(m, prefixes[i]);
+	g_bench_sink += found;
+	bench_report(label + " scan (per key)", bench_now() - start, found);
+	std::cout << "  " << label << " memory: " << bench_memory(m) / (1024 * 1024) << " MiB, "
+						<< bench_memory(m) / m.size() << " bytes per key" << std::endl;
+}
+
+/** bench_map_lookup through an rcu_map holding the filled Map: a reader
+ *	(epoch enter, pointer load, exit) around every find */
+template <class Map>
+void	bench_rcu_lookup(const std::string& label, std::size_t n) {
+	Map	filled;
+	bench_fill(filled, n);
+	ft::rcu_map<Map>	m(filled);
+
+	srand(42);
+	long long	start = bench_now();
+	long			sum = 0;
+	for (std::size_t i = 0; i < n; i++) {
+		typename ft::rcu_map<Map>::reader	r(m);
+		typename Map::const_iterator it = r->find(rand());
+		if (it != r->end())
+			sum += it->second;
+	}
+	g_bench_sink += sum;
+	bench_report(label, bench_now() - start, n);
+}
+
+/** looks up the 'n' filled keys in batches of 'batch', with a find() per
+ *	key or one find_batch() per batch (keys sorted first if 'sorted') */
+template <class Map>
+void	bench_map_find_batch(const std::string& label, std::size_t n, std::size_t batch, int mode) {
+	Map	m;
+	bench_fill(m, n);
+
+	ft::vector<typename Map::key_type>	keys;
+	keys.reserve(n);
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		keys.push_back(rand());
+	ft::vector<typename Map::iterator>	found(batch);
+
+	long long	start = bench_now();
+	long			sum = 0;
+	for (std::size_t first = 0; first < n; first += batch) {
+		std::size_t	last = first + batch < n ? first + batch : n;
+		if (mode == 0)
+			for (std::size_t i = first; i < last; i++)
+				found[i - first] = m.find(keys[i]);
+		else
+			m.find_batch(keys.begin() + first, keys.begin() + last, found.begin(), mode == 2);
+		for (std::size_t i = first; i < last; i++)
+			if (found[i - first] != m.end())
+				sum += found[i - first]->second;
+	}
+	g_bench_sink += sum;
+	bench_report(label, bench_now() - start, n);
+}
+
+/** 'queries' lookups among 'n' string keys, longer than the small string
+ *	buffer, by a Query made from a const char*: a plain comparator builds
+ *	a std::string for each, a transparent one compares the Query as is */
+template <class Map, class Query>
+void	bench_string_lookup(const std::string& label, std::size_t n, std::size_t queries) {
+	Map												m;
+	ft::vector<std::string>		names;
+	names.reserve(n);
+	for (std::size_t i = 0; i < n; i++) {
+		std::ostringstream	name;
+		name << "request-handler-key-" << (i * 7919) % n;
+		names.push_back(name.str());
+		m[names.back()] = int(i);
+	}
+
+	srand(42);
+	long long	start = bench_now();
+	long			sum = 0;
+	for (std::size_t i = 0; i < queries; i++) {
+		const std::string&			name = names[rand() % n];
+		typename Map::iterator	it = m.find(Query(name.c_str()));
+		if (it != m.end())
+			sum += it->second;
+	}
+	g_bench_sink += sum;
+	bench_report(label, bench_now() - start, queries);
+}
+
+/** 'n' operations on keys in [0, 2n) of which 'writes' percent are an
+ *	erase plus an insert and the rest lookups; sorted fill first, which
+ *	is the worst case for rebalancing */
+template <class Map>
+void	bench_map_mix(const std::string& label, std::size_t n, int writes) {
+	Map	m;
+
+	long long	start = bench_now();
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(typename Map::value_type(2 * i, i));
+	bench_report(label + " sorted fill", bench_now() - start, n);
+
+	srand(42);
+	long	sum = 0;
+	start = bench_now();
+	for (std::size_t i = 0; i < n; i++) {
+		if (rand() % 100 < writes) {
+			m.erase(rand() % (2 * n));
+			m.insert(typename Map::value_type(rand() % (2 * n), i));
+		}
+		else if (m.find(rand() % (2 * n)) != m.end())
+			++sum;
+	}
+	g_bench_sink += sum;
+	std::ostringstream	mix;
+	mix << label << " " << writes << "% writes";
+	bench_report(mix.str(), bench_now() - start, n);
+}
+
+/** builds a map from 'n' random pairs with a single range insert */
+template <class Map>
+void	bench_map_batch(const std::string& label, std::size_t n) {
+	ft::vector<ft::pair<int, int> >	batch;
+	batch.reserve(n);
+	srand(42);
+	for (std::size_t i = 0; i < n; i++)
+		batch.push_back(ft::pair<int, int>(rand(), i));
+
+	long long	start = bench_now();
+	Map				m(batch.begin(), batch.end());
+	bench_report(label, bench_now() - start, n);
+	g_bench_sink += m.size();
+}
+
+/** 'queries' sums over key ranges holding about 'width' elements each,
+ *	walking each range from lower_bound */
+template <class Map>
+void	bench_range_scan(const std::string& label, std::size_t n, std::size_t width, std::size_t queries) {
+	Map	m;
+	bench_fill(m, n);
+
+	int				span = int(RAND_MAX / n * width);
+	long			sum = 0;
+	srand(7);
+	long long	start = bench_now();
+	for (std::size_t q = 0; q < queries; q++) {
+		int lo = rand() % (RAND_MAX - span);
+		typename Map::const_iterator last = m.lower_bound(lo + span);
+		for (typename Map::const_iterator it = m.lower_bound(lo); it != last; ++it)
+			sum += it->second;
+	}
+	g_bench_sink += sum;
+	bench_report(label, bench_now() - start, queries);
+}
+
+/** the same queries answered by the map's aggregate(lo, hi) */
+template <class Map>
+void	bench_range_aggregate(const std::string& label, std::size_t n, std::size_t width, std::size_t queries) {
+	Map	m;
+	bench_fill(m, n);
+
+	int				span = int(RAND_MAX / n * width);
+	long			sum = 0;
+	srand(7);
+	long long	start = bench_now();
+	for (std::size_t q = 0; q < queries; q++) {
+		int lo = rand() % (RAND_MAX - span);
+		sum += m.aggregate(lo, lo + span);
+	}
+	g_bench_sink += sum;
+	bench_report(label, bench_now() - start, queries);
+}
+
+/** 'queries' additions to key ranges holding about 'width' elements each,
+ *	one value at a time from lower_bound */
+template <class Map>
+void	bench_range_add_scan(const std::string& label, std::size_t n, std::size_t width, std::size_t queries) {
+	Map	m;
+	bench_fill(m, n);
+
+	int				span = int(RAND_MAX / n * width);
+	srand(7);
+	long long	start = bench_now();
+	for (std::size_t q = 0; q < queries; q++) {
+		int lo = rand() % (RAND_MAX - span);
+		typename Map::iterator last = m.lower_bound(lo + span);
+		for (typename Map::iterator it = m.lower_bound(lo); it != last; ++it)
+			it->second += long(q & 7);
+	}
+	g_bench_sink += m.begin()->second;
+	bench_report(label, bench_now() - start, queries);
+}
+
+/** the same additions done by the map's add(lo, hi, delta) */
+template <class Map>
+void	bench_range_add(const std::string& label, std::size_t n, std::size_t width, std::size_t queries) {
+	Map	m;
+	bench_fill(m, n);
+
+	int				span = int(RAND_MAX / n * width);
+	srand(7);
+	long long	start = bench_now();
+	for (std::size_t q = 0; q < queries; q++) {
+		int lo = rand() % (RAND_MAX - span);
+		m.add(lo, lo + span, long(q & 7));
+	}
+	g_bench_sink += m.begin()->second;
+	bench_report(label, bench_now() - start, queries);
+}
+
+/** 'rounds' unions of a map of 'n' keys with one of 'm' keys, half of
+ *	them shared: one insert per element, or set_union() */
+template <class Map>
+void	bench_union_insert(const std::string& label, std::size_t n, std::size_t m, std::size_t rounds) {
+	long long	elapsed = 0;
+	for (std::size_t r = 0; r < rounds; r++) {
+		Map	big;
+		Map	small;
+		bench_fill(big, n);
+		for (typename Map::iterator it = big.begin(); small.size() < m / 2 && it != big.end(); ++it)
+			small.insert(*it);
+		while (small.size() < m)
+			small.insert(typename Map::value_type(rand(), 0));
+		long long	start = bench_now();
+		for (typename Map::iterator it = small.begin(); it != small.end(); ++it)
+			big.insert(*it);
+		elapsed += bench_now() - start;
+		g_bench_sink += big.size();
+	}
+	bench_report(label, elapsed, rounds);
+}
+
+template <class Map>
+void	bench_union_join(const std::string& label, std::size_t n, std::size_t m, std::size_t rounds) {
+	long long	elapsed = 0;
+	for (std::size_t r = 0; r < rounds; r++) {
+		Map	big;
+		Map	small;
+		bench_fill(big, n);
+		for (typename Map::iterator it = big.begin(); small.size() < m / 2 && it != big.end(); ++it)
+			small.insert(*it);
+		while (small.size() < m)
+			small.insert(typename Map::value_type(rand(), 0));
+		long long	start = bench_now();
+		big.set_union(small);
+		elapsed += bench_now() - start;
+		g_bench_sink += big.size();
+	}
+	bench_report(label, elapsed, rounds);
+}
+
+/** keeps the keys of a map of 'n' that are in one of 'm': a scan with a
+ *	lookup per element, or set_intersection() */
+template <class Map>
+void	bench_intersection(const std::string& label, std::size_t n, std::size_t m, std::size_t rounds, bool scan) {
+	long long	elapsed = 0;
+	for (std::size_t r = 0; r < rounds; r++) {
+		Map	big;
+		Map	small;
+		bench_fill(big, n);
+		for (typename Map::iterator it = big.begin(); small.size() < m && it != big.end(); ++it)
+			if (rand() % 2)
+				small.insert(*it);
+		long long	start = bench_now();
+		if (scan) {
+			for (typename Map::iterator it = big.begin(); it != big.end(); )
+				if (small.find(it->first) == small.end())
+					big.erase(it++);
+				else
+					++it;
+		}
+		else
+			big.set_intersection(small);
+		elapsed += bench_now() - start;
+		g_bench_sink += big.size();
+	}
+	bench_report(label, elapsed, rounds);
+}
+
+/** moves every other element of a map of 'n' into another map: a copy
+ *	into the target and an erase from the source, or extract() and
+ *	insert(node_handle), which relinks the node */
+template <class Map>
+void	bench_move_entries(const std::string& label, std::size_t n, bool extract) {
+	Map	source;
+	Map	target;
+	bench_fill(source, n);
+
+	long long	start = bench_now();
+	bool			odd = false;
+	for (typename Map::iterator it = source.begin(); it != source.end(); odd = !odd) {
+		if (!odd) {
+			++it;
+			continue;
+		}
+		typename Map::iterator next = it;
+		++next;
+		if (extract)
+			target.insert(source.extract(it));
+		else {
+			target.insert(*it);
+			source.erase(it);
+		}
+		it = next;
+	}
+	g_bench_sink += target.size();
+	bench_report(label, bench_now() - start, target.size());
+}
+
+/** m[k] = v, through insert_or_assign for maps without operator[] */
+template <class Map>
+void	bench_assign(Map& m, int k, int v) { m[k] = v; }
+
+template <class K, class V>
+void	bench_assign(ft::persistent_map<K, V>& m, int k, int v) { m.insert_or_assign(k, v); }
+
+/** 'updates' random assignments, with a snapshot (copy) of the map kept
+ *	for readers every 'every' updates; both are in the time per update */
+template <class Map>
+void	bench_snapshots(const std::string& label, std::size_t n, std::size_t updates, std::size_t every) {
+	Map	m;
+	Map	snapshot;
+	bench_fill(m, n);
+
+	long long	start = bench_now();
+	for (std::size_t i = 0; i < updates; i++) {
+		bench_assign(m, rand(), i);
+		if (i % every == 0)
+			snapshot = m;
+	}
+	g_bench_sink += snapshot.size();
+	bench_report(label, bench_now() - start, updates);
+}
+
+/** ft::map behind one mutex, the way it is shared without sharded_map */
+template <class K, class V>
+class bench_locked_map {
+	pthread_mutex_t	_lock;
+	ft::map<K, V>		_map;
+
+	public:
+		bench_locked_map() { pthread_mutex_init(&_lock, NULL); }
+		~bench_locked_map() { pthread_mutex_destroy(&_lock); }
+
+		bool insert(const ft::pair<const K, V>& val) {
+			pthread_mutex_lock(&_lock);
+			bool inserted = _map.insert(val).second;
+			pthread_mutex_unlock(&_lock);
+			return inserted;
+		}
+
+		void insert_or_assign(const K& k, const V& v) {
+			pthread_mutex_lock(&_lock);
+			_map[k] = v;
+			pthread_mutex_unlock(&_lock);
+		}
+
+		bool get(const K& k, V& out) {
+			pthread_mutex_lock(&_lock);
+			typename ft::map<K, V>::iterator it = _map.find(k);
+			bool found = it != _map.end();
+			if (found)
+				out = it->second;
+			pthread_mutex_unlock(&_lock);
+			return found;
+		}
+};
+
+/** ft::concurrent_skiplist_map with the calls of bench_concurrent: its
+ *	elements are const, so a write is an erase then an insert */
+template <class K, class V>
+class bench_skiplist_map : public ft::concurrent_skiplist_map<K, V> {
+	public:
+		void insert_or_assign(const K& k, const V& v) {
+			this->erase(k);
+			this->insert(ft::pair<const K, V>(k, v));
+		}
+
+		bool get(const K& k, V& out) const {
+			typename ft::concurrent_skiplist_map<K, V>::guard	guard(*this);
+			typename ft::concurrent_skiplist_map<K, V>::const_iterator it = this->find(k);
+			if (it == this->end())
+				return false;
+			out = it->second;
+			return true;
+		}
+};
+
+template <class Map>
+struct bench_thread_job {
+	Map*				map;
+	std::size_t	keys;
+	std::size_t	ops;
+	unsigned		seed;
+	long				sum;
+};
+
+/** one thread of bench_concurrent: 1 write for 9 reads on random keys
+ *	(xorshift per thread: rand() would serialise the threads on its state) */
+template <class Map>
+void*	bench_concurrent_worker(void* arg) {
+	bench_thread_job<Map>*	job = static_cast<bench_thread_job<Map>*>(arg);
+	unsigned								x = job->seed;
+	int											value = 0;
+
+	for (std::size_t i = 0; i < job->ops; i++) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		int k = x % job->keys;
+		if (i % 10 == 0)
+			job->map->insert_or_assign(k, i);
+		else if (job->map->get(k, value))
+			job->sum += value;
+	}
+	return NULL;
+}
+
+/** 'ops' operations on a map of 'n' keys, split over 'threads' threads */
+template <class Map>
+void	bench_concurrent(const std::string& label, std::size_t n, std::size_t ops, std::size_t threads) {
+	Map												m;
+	pthread_t									ids[16];
+	bench_thread_job<Map>			jobs[16];
+
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(ft::pair<const int, int>(i, i));
+	long long	start = bench_now();
+	for (std::size_t t = 0; t < threads; t++) {
+		bench_thread_job<Map> job = { &m, n, ops / threads, 2463534242u + 7 * unsigned(t), 0 };
+		jobs[t] = job;
+		pthread_create(&ids[t], NULL, bench_concurrent_worker<Map>, &jobs[t]);
+	}
+	for (std::size_t t = 0; t < threads; t++) {
+		pthread_join(ids[t], NULL);
+		g_bench_sink += jobs[t].sum;
+	}
+	std::ostringstream	name;
+	name << label << ", " << threads << " thread" << (threads > 1 ? "s" : "");
+	bench_report(name.str(), bench_now() - start, ops);
+}
+
+/** build-once, drop-all maps: 'requests' maps of 'n / requests' elements,
+ *	timing the build and the teardown separately */
+template <class Map>
+void	bench_map_requests(const std::string& label, std::size_t n, std::size_t requests) {
+	std::size_t	per_request = n / requests;
+	long long		build = 0;
+	long long		teardown = 0;
+
+	srand(42);
+	for (std::size_t r = 0; r < requests; r++) {
+		long long	start = bench_now();
+		Map*			m = new Map();
+		for (std::size_t i = 0; i < per_request; i++)
+			m->insert(typename Map::value_type(rand(), i));
+		long long	built = bench_now();
+		delete m;
+		build += built - start;
+		teardown += bench_now() - built;
+	}
+	bench_report(label + " build", build, requests * per_request);
+	bench_report(label + " teardown", teardown, requests * per_request);
+}
+
+void	bench_map(std::size_t n) {
+	bench_title("map: in-order scan (++ and --)");
+	bench_map_scan<std::map<int, int> >("std::map", n, 5);
+	bench_map_scan<ft_map>("ft::map", n, 5);
+	bench_map_scan<ft_threaded_map>("ft::map tree_policy<threaded>", n, 5);
+
+	bench_title("map: node allocation (std::allocator vs node_pool_allocator)");
+	bench_map_churn<std::map<int, int> >("std::map", n, false);
+	bench_map_churn<ft_map>("ft::map", n, false);
+	bench_map_churn<ft_pool_map>("ft::map pool", n, false);
+	bench_map_churn<ft_pool_map>("ft::map pool reserve(n)", n, true);
+
+	bench_title("map: per-request maps (std::allocator vs node pool vs arena)");
+	bench_map_requests<std::map<int, int> >("std::map", n, 100);
+	bench_map_requests<ft_map>("ft::map", n, 100);
+	bench_map_requests<ft_pool_map>("ft::map pool", n, 100);
+	bench_map_requests<ft_arena_map>("ft::map arena", n, 100);
+
+	bench_title("map: balancing policy (AVL vs red-black)");
+	bench_map_mix<std::map<int, int> >("std::map", n, 90);
+	bench_map_mix<ft_map>("ft::map avl", n, 90);
+	bench_map_mix<ft_rb_map>("ft::map red-black", n, 90);
+	bench_map_mix<std::map<int, int> >("std::map", n, 10);
+	bench_map_mix<ft_map>("ft::map avl", n, 10);
+	bench_map_mix<ft_rb_map>("ft::map red-black", n, 10);
+
+	bench_title("map: node layout (pointer links vs 32-bit index links)");
+	std::cout << "  node bytes: ft::map " << sizeof(ft_map::node_type)
+						<< ", ft::compact_map " << sizeof(ft_compact_map::node_type) << std::endl;
+	bench_map_lookup<std::map<int, int> >("std::map find", n);
+	bench_map_lookup<ft_map>("ft::map find", n);
+	bench_map_lookup<ft_compact_map>("ft::compact_map find", n);
+	bench_map_scan<ft_map>("ft::map scan", n, 5);
+	bench_map_scan<ft_compact_map>("ft::compact_map scan", n, 5);
+	bench_map_churn<ft_map>("ft::map", n, false);
+	bench_map_churn<ft_compact_map>("ft::compact_map", n, false);
+
+	bench_title("map: B+tree (512-byte nodes, SSE2 search for int keys)");
+	bench_map_lookup<std::map<int, int> >("std::map find", n);
+	bench_map_lookup<ft_map>("ft::map find", n);
+	bench_map_lookup<ft_btree_map>("ft::btree_map find", n);
+	bench_map_scan<ft_btree_map>("ft::btree_map scan", n, 5);
+	bench_map_churn<ft_btree_map>("ft::btree_map", n, false);
+	bench_map_mix<ft_btree_map>("ft::btree_map", n, 10);
+
+	bench_title("map: flat_map (sorted key and value arrays)");
+	bench_map_batch<ft_map>("ft::map range insert", n);
+	bench_map_batch<ft_flat_map>("ft::flat_map range insert", n);
+	bench_map_lookup<ft_map>("ft::map find", n);
+	bench_map_lookup<ft_btree_map>("ft::btree_map find", n);
+	bench_map_lookup<ft_flat_map>("ft::flat_map find", n);
+	bench_map_scan<ft_map>("ft::map scan", n, 5);
+	bench_map_scan<ft_btree_map>("ft::btree_map scan", n, 5);
+	bench_map_scan<ft_flat_map>("ft::flat_map scan", n, 5);
+
+	bench_title("map: frozen_map (Eytzinger layout, branchless prefetched search)");
+	bench_map_lookup<ft_map>("ft::map find", n);
+	bench_map_lookup<ft_flat_map>("ft::flat_map find", n);
+	bench_map_lookup<ft_frozen_map>("ft::frozen_map find", n);
+	bench_map_scan<ft_frozen_map>("ft::frozen_map scan", n, 5);
+
+	bench_title("map: range aggregation (monoid_augment<sum_of<long> >)");
+	std::cout << "  node bytes: ft::map " << sizeof(ft_map::node_type)
+						<< ", order_statistics " << sizeof(ft_os_map::node_type)
+						<< ", sum_of<long> " << sizeof(ft_sum_map::node_type)
+						<< ", min_of<int> " << sizeof(ft_min_map::node_type) << std::endl;
+	bench_map_lookup<ft_sum_map>("ft::map sum_of find", n);
+	bench_map_churn<ft_sum_map>("ft::map sum_of", n, false);
+	bench_range_scan<std::map<int, int> >("std::map scan ~1000 per range", n, 1000, 10000);
+	bench_range_aggregate<ft_sum_map>("ft::map aggregate ~1000 per range", n, 1000, 10000);
+	bench_range_aggregate<ft_sum_map>("ft::map aggregate ~10 per range", n, 10, 10000);
+
+	bench_title("map: lazy range additions (range_add<long>)");
+	std::cout << "  node bytes: ft::map<int, long> " << sizeof(ft::map<int, long>::node_type)
+						<< ", range_add<long> " << sizeof(ft_add_map::node_type) << std::endl;
+	bench_map_lookup<ft_add_map>("ft::map range_add find", n);
+	bench_range_add_scan<std::map<int, long> >("std::map add ~1000 per range", n, 1000, 10000);
+	bench_range_add<ft_add_map>("ft::map add ~1000 per range", n, 1000, 10000);
+	bench_range_add<ft_add_map>("ft::map add ~10 per range", n, 10, 10000);
+
+	bench_title("map: batched lookups (256 keys per batch, all hits)");
+	bench_map_find_batch<ft_map>("ft::map find loop", n, 256, 0);
+	bench_map_find_batch<ft_map>("ft::map find_batch", n, 256, 1);
+	bench_map_find_batch<ft_map>("ft::map find_batch sorted", n, 256, 2);
+	bench_map_find_batch<ft_map>("ft::map find loop, 64k map", 65536, 256, 0);
+	bench_map_find_batch<ft_map>("ft::map find_batch, 64k map", 65536, 256, 1);
+
+	bench_title("map: 1k string keys looked up by const char* or string_view");
+	bench_string_lookup<ft::map<std::string, int>, const char*>("ft::map std::less find(const char*)", 1000, n);
+	bench_string_lookup<ft::map<std::string, int, ft::transparent_less>, const char*>("ft::map transparent find(const char*)", 1000, n);
+	bench_string_lookup<ft::map<std::string, int, ft::transparent_less>, ft::string_view>("ft::map transparent find(string_view)", 1000, n);
+	bench_string_lookup<ft::map<std::string, int>, std::string>("ft::map std::less find(std::string)", 1000, n);
+	bench_string_lookup<ft::map<std::string, int, ft::three_way_less>, std::string>("ft::map three_way find(std::string)", 1000, n);
+	bench_string_lookup<ft::map<std::string, int, ft::three_way_less>, ft::string_view>("ft::map three_way find(string_view)", 1000, n);
+
+	bench_title("map: set operations (join-based, per operation)");
+	bench_union_insert<ft_map>("ft::map insert n into n", n, n, 3);
+	bench_union_join<ft_map>("ft::map set_union n into n", n, n, 3);
+	bench_union_insert<ft_map>("ft::map insert 1k into n", n, 1000, 10);
+	bench_union_join<ft_map>("ft::map set_union 1k into n", n, 1000, 10);
+	bench_union_join<ft_rb_map>("ft::map red-black set_union 1k into n", n, 1000, 10);
+	bench_intersection<ft_map>("ft::map scan + find, keep 1k of n", n, 1000, 5, true);
+	bench_intersection<ft_map>("ft::map set_intersection 1k of n", n, 1000, 5, false);
+
+	bench_title("map: moving entries between maps (per element)");
+	bench_move_entries<ft_map>("ft::map insert + erase", n, false);
+	bench_move_entries<ft_map>("ft::map extract + insert(node)", n, true);
+	bench_move_entries<ft_pool_map>("ft::map pool insert + erase", n, false);
+	bench_move_entries<ft_pool_map>("ft::map pool extract + insert(node)", n, true);
+
+	bench_title("map: versions for readers (full copy vs path-copying persistent_map)");
+	bench_snapshots<ft_map>("ft::map, copy per 1000 updates", n, 10000, 1000);
+	bench_snapshots<ft_persistent_map>("persistent_map, snapshot per 1000", n, 10000, 1000);
+	bench_snapshots<ft_persistent_map>("persistent_map, snapshot per update", n, 10000, 1);
+	bench_map_lookup<ft_map>("ft::map find", n);
+	bench_map_lookup<ft_persistent_map>("ft::persistent_map find", n);
+	bench_map_scan<ft_persistent_map>("ft::persistent_map scan", n, 5);
+
+	bench_title("map: shared between threads (10% writes, wall time per operation)");
+	for (std::size_t threads = 1; threads <= 8; threads *= 2)
+		bench_concurrent<bench_locked_map<int, int> >("ft::map + mutex", n, n, threads);
+	for (std::size_t threads = 1; threads <= 8; threads *= 2)
+		bench_concurrent<ft_sharded_map>("ft::sharded_map<16>", n, n, threads);
+	for (std::size_t threads = 1; threads <= 8; threads *= 2)
+		bench_concurrent<bench_skiplist_map<int, int> >("ft::concurrent_skiplist_map", n, n, threads);
+
+	bench_title("map: write bursts (log-structured merge, blind writes)");
+	bench_write_burst<ft_map>("ft::map", n, false);
+	bench_write_burst<ft_btree_map>("ft::btree_map", n, false);
+	bench_write_burst<ft_lsm_map>("ft::lsm_map", n, false);
+	bench_write_burst<ft_lsm_map>("ft::lsm_map", n, true);
+
+	bench_title("map: adaptive radix tree (random 64-bit keys, 10 x elements)");
+	bench_u64_keys<ft::map<uint64_t, int> >("ft::map", 10 * n);
+	bench_u64_keys<ft::art_map<uint64_t, int> >("ft::art_map", 10 * n);
+	bench_path_keys<ft::map<std::string, int> >("ft::map<string> paths", n);
+	bench_path_keys<ft::art_map<std::string, int> >("ft::art_map<string> paths", n);
+
+	bench_title("map: path keys (prefix-compressed trie)");
+	bench_path_keys<ft::map<std::string, int> >("ft::map", n);
+	bench_path_keys<ft::prefix_map<int> >("ft::prefix_map", n);
+	bench_path_scan<ft::map<std::string, int> >("ft::map", n);
+	bench_path_scan<ft::prefix_map<int> >("ft::prefix_map", n);
+
+	bench_title("map: read-mostly publication (RCU, reader per lookup)");
+	bench_map_lookup<ft_map>("ft::map find", n);
+	bench_rcu_lookup<ft_map>("rcu_map<ft::map> find", n);
+	bench_map_lookup<ft_frozen_map>("ft::frozen_map find", n);
+	bench_rcu_lookup<ft_frozen_map>("rcu_map<ft::frozen_map> find", n);
+
+	bench_title("map: hashing (Swiss table, SSE2 group probing)");
+	bench_map_lookup<ft_map>("ft::map find", n);
+	bench_map_lookup<tr1_unordered_map>("tr1::unordered_map find", n);
+	bench_map_lookup<ft_unordered_map>("ft::unordered_map find", n);
+	bench_map_churn<ft_map>("ft::map", n, false);
+	bench_map_churn<tr1_unordered_map>("tr1::unordered_map", n, false);
+	bench_map_churn<ft_unordered_map>("ft::unordered_map", n, false);
+	bench_map_churn<ft_unordered_map>("ft::unordered_map reserved", n, true);
+	bench_map_mix<tr1_unordered_map>("tr1::unordered_map", n, 10);
+	bench_map_mix<ft_unordered_map>("ft::unordered_map", n, 10);
+}
@@ -0,0 +1,15 @@
+#include <cstdlib>
+#include "bench.hpp"
+#include "bench_map.cpp"
+
+/**	@usage: ./bench_containers [elements]
+ *	Builds with optimisations and without sanitizers (make bench) */
+int	main(int argc, char **argv) {
+	std::size_t	n = 1000000;
+
+	if (argc > 1)
+		n = strtoul(argv[1], NULL, 10);
+	std::cout << "elements: " << n << std::endl;
+	bench_map(n);
+	return (0);
+}
@@ -0,0 +1,663 @@
+#ifndef _ART_MAP_HPP_
+#define _ART_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <new>
+#include "../inc/pair.hpp"
+#include "../inc/radix_key.hpp"
+#include "../inc/art_node.hpp"
+#include "../inc/art_iterator.hpp"
+#include "../inc/reverse_iterator.hpp"
+#include "../inc/lex_compare.hpp"
+
+namespace ft {
+
+	/*-------------*/
+ /**	ART:MAP:  */
+/*-------------*/
+
+/**	@brief Ordered map on an adaptive radix tree: the key is read as bytes
+ *	(ft::radix_key) and each inner node branches on one byte, so a lookup
+ *	makes at most one step per key byte, with no key comparison on the way
+ *	down and one at the leaf. Nodes grow and shrink between 4, 16, 48 and
+ *	256 children with their fan-out (art_node), a chain of single-child
+ *	nodes collapses into a compressed prefix, and a key is only expanded
+ *	into nodes as far as it differs from the others (a lone key is a leaf).
+ *	An insert that throws leaves the map as it was: the new leaf and node
+ *	are made before anything in the tree changes.
+ *	insert() throws std::invalid_argument for a key whose bytes are those
+ *	of a key already in (see radix_key: "a" and "a\0").
+ *	Keys are ordered by their bytes, which for the supported types is their
+ *	usual order: there is no Compare parameter.
+ *	Leaves are chained in order (art_iterator), so iteration never walks
+ *	the tree and iterators stay valid as long as their element is in.
+ *	scan_prefix() gives the range of keys starting with some bytes. */
+template <class Key,
+					class T,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class art_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef std::less<Key>										key_compare;
+
+/** @value_compare: compares the key of objects of type art_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class art_map;
+			protected:
+				key_compare comp;
+				value_compare (key_compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::reference																					reference;
+		typedef typename Alloc::const_reference																		const_reference;
+		typedef typename Alloc::pointer																						pointer;
+		typedef typename Alloc::const_pointer																			const_pointer;
+		typedef ft::radix_key<Key>																								traits_type;
+		typedef ft::art_node																											node_type;
+		typedef ft::art_leaf<value_type>																					leaf_type;
+		typedef typename Alloc::template rebind<char>::other											byte_allocator_type;
+		typedef ft::art_iterator<value_type, leaf_type>														iterator;
+		typedef ft::art_iterator<const value_type, leaf_type>											const_iterator;
+		typedef ft::reverse_iterator<iterator>																		reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>															const_reverse_iterator;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+		node_type*						_root;			// a node, a tagged leaf or NULL
+		leaf_type*						_header;		// closes the ring of leaves: end()
+		size_type							_size;
+		size_type							_memory;		// bytes in nodes and leaves
+		allocator_type				_alloc;
+		byte_allocator_type		_bytes;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit art_map (const key_compare& = key_compare(),
+											const allocator_type& alloc = allocator_type()) :
+		_root(NULL), _header(NULL), _size(0), _memory(0), _alloc(alloc), _bytes(alloc) {
+			_header = _new_header();
+		}
+
+		template <class InputIterator>
+		art_map (InputIterator first, InputIterator last,
+						const key_compare& = key_compare(),
+						const allocator_type& alloc = allocator_type()) :
+		_root(NULL), _header(NULL), _size(0), _memory(0), _alloc(alloc), _bytes(alloc) {
+			_header = _new_header();
+			insert(first, last);
+		}
+
+		art_map (const art_map& x) :
+		_root(NULL), _header(NULL), _size(0), _memory(0), _alloc(x._alloc), _bytes(x._alloc) {
+			_header = _new_header();
+			insert(x.begin(), x.end());
+		}
+
+/**	DESTRUCTOR: 	*/
+		~art_map() {
+			clear();
+			_bytes.deallocate(reinterpret_cast<char*>(_header), sizeof(leaf_type));
+		}
+
+		art_map& operator= (const art_map& x) {
+			if (this == &x) return *this;
+			clear();
+			insert(x.begin(), x.end());
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		iterator begin() { return iterator(_header->_next); }
+		const_iterator begin() const { return const_iterator(_header->_next); }
+		iterator end() { return iterator(_header); }
+		const_iterator end() const { return const_iterator(_header); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _size == 0; }
+		size_type size() const { return _size; }
+		size_type max_size() const { return _bytes.max_size() / sizeof(leaf_type); }
+
+	/** bytes held by the nodes and leaves */
+		size_type memory() const { return _memory; }
+
+/** ELEMENT:ACCESS:	***/
+		mapped_type& operator[] (const key_type& k) {
+			return (*(insert(ft::make_pair(k, mapped_type())).first)).second;
+		}
+
+		mapped_type& at (const key_type& k) {
+			iterator it = find(k);
+			if (it == end()) throw std::out_of_range("art_map::at: out of range");
+			return it->second;
+		}
+
+		const mapped_type& at (const key_type& k) const {
+			const_iterator it = find(k);
+			if (it == end()) throw std::out_of_range("art_map::at: out of range");
+			return it->second;
+		}
+
+/** MODIFIERS:	***/
+	/** @brief Descends as far as the key's bytes lead, then either adds a
+	 *	leaf to the node it stopped at (growing it if full), splits the
+	 *	compressed prefix it disagreed with, or turns the leaf it reached
+	 *	into a node4 holding both keys below their common bytes. The new
+	 *	leaf is linked in the ring before the first leaf above it. */
+		pair<iterator, bool> insert (const value_type& val) {
+			const key_type&	k = val.first;
+			node_type**			slot = &_root;
+			size_type				depth = 0;
+
+			if (_root == NULL) {
+				leaf_type* leaf = _new_leaf(val, _header);
+				_root = node_type::tag(leaf);
+				return ft::make_pair(iterator(leaf), true);
+			}
+			while (true) {
+				node_type* node = *slot;
+				if (node_type::is_leaf(node)) {
+					leaf_type* other = node_type::leaf<leaf_type>(node);
+					const key_type& o = other->_data.first;
+					if (o == k)
+						return ft::make_pair(iterator(other), false);
+					size_type p = depth;
+					size_type end = traits_type::size(o) > traits_type::size(k) ? traits_type::size(o) : traits_type::size(k);
+					while (p < end && traits_type::byte(o, p) == traits_type::byte(k, p))
+						++p;
+					if (p == end)		// two keys, one string of bytes ("a" and "a\0")
+						throw std::invalid_argument("art_map::insert: key reads as the bytes of another");
+					unsigned char kb = traits_type::byte(k, p);
+					unsigned char ob = traits_type::byte(o, p);
+					leaf_type* leaf = _new_leaf(val, kb < ob ? other : other->_next);
+					art_node4* split = _new_split(leaf);
+					_set_prefix(split, k, depth, p - depth);
+					split->add_child(ob, node);
+					split->add_child(kb, node_type::tag(leaf));
+					*slot = split;
+					return ft::make_pair(iterator(leaf), true);
+				}
+				size_type mismatch = _mismatch(node, k, depth);
+				if (mismatch < node->_prefix_len) {
+					unsigned char kb = traits_type::byte(k, depth + mismatch);
+					unsigned char nb = _prefix_byte(node, depth, mismatch);
+					leaf_type* next = kb < nb ? _min_leaf(node) : _max_leaf(node)->_next;
+					leaf_type* leaf = _new_leaf(val, next);
+					art_node4* split = _new_split(leaf);
+					split->_prefix_len = mismatch;
+					std::memcpy(split->_prefix, node->_prefix, mismatch < node_type::max_prefix ? mismatch : node_type::max_prefix);
+					_cut_prefix(node, depth, mismatch + 1);
+					split->add_child(nb, node);
+					split->add_child(kb, node_type::tag(leaf));
+					*slot = split;
+					return ft::make_pair(iterator(leaf), true);
+				}
+				depth += node->_prefix_len;
+				unsigned char b = traits_type::byte(k, depth);
+				node_type** child = node->find_child(b);
+				if (child) {
+					slot = child;
+					++depth;
+					continue;
+				}
+				if (node->full())		// a bigger node with the same children is still right
+					node = _resize(slot, node->_type + 1);
+				node_type* above = node->child_above(b);
+				leaf_type* leaf = _new_leaf(val, above ? _min_leaf(above) : _max_leaf(node)->_next);
+				node->add_child(b, node_type::tag(leaf));
+				return ft::make_pair(iterator(leaf), true);
+			}
+		}
+
+		iterator insert (iterator, const value_type& val) { return insert(val).first; }
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		void erase (iterator position) {
+			if (position == end()) return;
+			key_type k(position->first);
+			erase(k);
+		}
+
+	/** removes the leaf from its node, which shrinks to the next size down
+	 *	once sparse enough, and a node4 left with one child is replaced by it */
+		size_type erase (const key_type& k) {
+			node_type**	slot = &_root;
+			size_type		depth = 0;
+
+			if (_root == NULL)
+				return 0;
+			if (node_type::is_leaf(_root)) {
+				leaf_type* leaf = node_type::leaf<leaf_type>(_root);
+				if (!(leaf->_data.first == k))
+					return 0;
+				_root = NULL;
+				_delete_leaf(leaf);
+				return 1;
+			}
+			while (true) {
+				node_type* node = *slot;
+				size_type stored = node->_prefix_len < node_type::max_prefix ? node->_prefix_len : node_type::max_prefix;
+				for (size_type i = 0; i < stored; ++i)
+					if (node->_prefix[i] != traits_type::byte(k, depth + i))
+						return 0;
+				depth += node->_prefix_len;
+				unsigned char b = traits_type::byte(k, depth);
+				node_type** child = node->find_child(b);
+				if (!child)
+					return 0;
+				if (!node_type::is_leaf(*child)) {
+					slot = child;
+					++depth;
+					continue;
+				}
+				leaf_type* leaf = node_type::leaf<leaf_type>(*child);
+				if (!(leaf->_data.first == k))
+					return 0;
+				node->remove_child(b);
+				_shrink(slot);
+				_delete_leaf(leaf);
+				return 1;
+			}
+		}
+
+		void erase (iterator first, iterator last) {
+			while (first != last) {
+				iterator next = first;
+				++next;
+				erase(first);
+				first = next;
+			}
+		}
+
+		void swap (art_map& x) {
+			node_type* root = _root;
+			_root = x._root;
+			x._root = root;
+
+			leaf_type* header = _header;
+			_header = x._header;
+			x._header = header;
+
+			size_type size = _size;
+			_size = x._size;
+			x._size = size;
+
+			size_type memory = _memory;
+			_memory = x._memory;
+			x._memory = memory;
+
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+
+			byte_allocator_type bytes = _bytes;
+			_bytes = x._bytes;
+			x._bytes = bytes;
+		}
+
+		void clear() {
+			if (_root)
+				_destroy(_root);
+			_root = NULL;
+			_size = 0;
+			_header->_prev = _header;
+			_header->_next = _header;
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return key_compare(); }
+		value_compare value_comp() const { return value_compare(key_compare()); }
+
+/** OPERATIONS:	***/
+	/** @brief Checks only the prefix bytes a node keeps and jumps over the
+	 *	others: the key compared at the leaf settles it */
+		iterator find (const key_type& k) {
+			node_type*	node = _root;
+			size_type		depth = 0;
+
+			while (node && !node_type::is_leaf(node)) {
+				size_type stored = node->_prefix_len < node_type::max_prefix ? node->_prefix_len : node_type::max_prefix;
+				for (size_type i = 0; i < stored; ++i)
+					if (node->_prefix[i] != traits_type::byte(k, depth + i))
+						return end();
+				depth += node->_prefix_len;
+				node_type** child = node->find_child(traits_type::byte(k, depth));
+				if (!child)
+					return end();
+				node = *child;
+				++depth;
+			}
+			if (!node)
+				return end();
+			leaf_type* leaf = node_type::leaf<leaf_type>(node);
+			return leaf->_data.first == k ? iterator(leaf) : end();
+		}
+
+		const_iterator find (const key_type& k) const { return const_cast<art_map*>(this)->find(k); }
+
+		size_type count (const key_type& k) const { return find(k) != end(); }
+
+		iterator lower_bound (const key_type& k) { return iterator(_bound(k, traits_type::size(k), false)); }
+		const_iterator lower_bound (const key_type& k) const { return const_iterator(_bound(k, traits_type::size(k), false)); }
+
+		iterator upper_bound (const key_type& k) { return iterator(_bound(k, traits_type::size(k), true)); }
+		const_iterator upper_bound (const key_type& k) const { return const_iterator(_bound(k, traits_type::size(k), true)); }
+
+		pair<iterator, iterator> equal_range (const key_type& k) {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+	/** the keys whose first 'bytes' bytes are those of 'prefix' (by default
+	 *	radix_key::prefix_size: a string without its terminator, all of an
+	 *	integer), in order */
+		pair<iterator, iterator> scan_prefix (const key_type& prefix) {
+			return scan_prefix(prefix, traits_type::prefix_size(prefix));
+		}
+		pair<iterator, iterator> scan_prefix (const key_type& prefix, size_type bytes) {
+			return ft::make_pair(iterator(_bound(prefix, bytes, false)), iterator(_bound(prefix, bytes, true)));
+		}
+		pair<const_iterator, const_iterator> scan_prefix (const key_type& prefix) const {
+			return scan_prefix(prefix, traits_type::prefix_size(prefix));
+		}
+		pair<const_iterator, const_iterator> scan_prefix (const key_type& prefix, size_type bytes) const {
+			return ft::make_pair(const_iterator(_bound(prefix, bytes, false)), const_iterator(_bound(prefix, bytes, true)));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+		leaf_type* _new_header() {
+			leaf_type* header = reinterpret_cast<leaf_type*>(_bytes.allocate(sizeof(leaf_type)));
+			header->_prev = header;
+			header->_next = header;
+			return header;
+		}
+
+	/** a leaf holding 'val', linked before 'next' */
+		leaf_type* _new_leaf(const value_type& val, leaf_type* next) {
+			leaf_type* leaf = reinterpret_cast<leaf_type*>(_bytes.allocate(sizeof(leaf_type)));
+			try {
+				new (static_cast<void*>(&leaf->_data)) value_type(val);
+			}
+			catch (...) {
+				_bytes.deallocate(reinterpret_cast<char*>(leaf), sizeof(leaf_type));
+				throw;
+			}
+			leaf->link_before(next);
+			_memory += sizeof(leaf_type);
+			++_size;
+			return leaf;
+		}
+
+		void _delete_leaf(leaf_type* leaf) {
+			leaf->unlink();
+			leaf->_data.~value_type();
+			_bytes.deallocate(reinterpret_cast<char*>(leaf), sizeof(leaf_type));
+			_memory -= sizeof(leaf_type);
+			--_size;
+		}
+
+		static size_type _node_bytes(int type) {
+			static const size_type	bytes[4] = { sizeof(art_node4), sizeof(art_node16), sizeof(art_node48), sizeof(art_node256) };
+			return bytes[type];
+		}
+
+	/** the node4 splitting a key from 'leaf', just made: on failure the leaf
+	 *	goes again, so that the tree is left as it was */
+		art_node4* _new_split(leaf_type* leaf) {
+			try {
+				return _new_node<art_node4>();
+			}
+			catch (...) {
+				_delete_leaf(leaf);
+				throw;
+			}
+		}
+
+		template <class N>
+		N* _new_node() {
+			N* node = new (static_cast<void*>(_bytes.allocate(sizeof(N)))) N();
+			_memory += sizeof(N);
+			return node;
+		}
+
+		node_type* _new_node(int type) {
+			switch (type) {
+				case node_type::node4:	return _new_node<art_node4>();
+				case node_type::node16:	return _new_node<art_node16>();
+				case node_type::node48:	return _new_node<art_node48>();
+				default:								return _new_node<art_node256>();
+			}
+		}
+
+		void _delete_node(node_type* node) {
+			_memory -= _node_bytes(node->_type);
+			_bytes.deallocate(reinterpret_cast<char*>(node), _node_bytes(node->_type));
+		}
+
+		void _destroy(node_type* node) {
+			if (node_type::is_leaf(node)) {
+				leaf_type* leaf = node_type::leaf<leaf_type>(node);
+				leaf->_data.~value_type();
+				_bytes.deallocate(reinterpret_cast<char*>(leaf), sizeof(leaf_type));
+				_memory -= sizeof(leaf_type);
+				return;
+			}
+			for (size_type b = node->next_byte(0); b < 256; b = node->next_byte(b + 1))
+				_destroy(*node->find_child(static_cast<unsigned char>(b)));
+			_delete_node(node);
+		}
+
+	/** replaces the node in 'slot' by one of another size, same prefix and
+	 *	children */
+		node_type* _resize(node_type** slot, int type) {
+			node_type* node = *slot;
+			node_type* resized = _new_node(type);
+			resized->_prefix_len = node->_prefix_len;
+			std::memcpy(resized->_prefix, node->_prefix, node_type::max_prefix);
+			node->copy_children(resized);
+			_delete_node(node);
+			*slot = resized;
+			return resized;
+		}
+
+	/** after a child went: a node4 with one child left gives way to it (its
+	 *	prefix, the byte and the child's prefix joined), a sparse node moves
+	 *	to the next size down */
+		void _shrink(node_type** slot) {
+			node_type* node = *slot;
+			switch (node->_type) {
+				case node_type::node4: {
+					if (node->_count > 1)
+						return;
+					node_type* child = node->first_child();
+					if (!node_type::is_leaf(child)) {
+						unsigned char	joined[node_type::max_prefix];
+						size_type			n = node->_prefix_len < node_type::max_prefix ? node->_prefix_len : node_type::max_prefix;
+						std::memcpy(joined, node->_prefix, n);
+						if (n < node_type::max_prefix)
+							joined[n++] = node->only_key();
+						for (size_type i = 0; n < node_type::max_prefix && i < child->_prefix_len; ++i)
+							joined[n++] = child->_prefix[i];
+						std::memcpy(child->_prefix, joined, n);
+						child->_prefix_len += node->_prefix_len + 1;
+					}
+					_delete_node(node);
+					*slot = child;
+					return;
+				}
+				case node_type::node16:
+					if (node->_count <= 3)
+						_resize(slot, node_type::node4);
+					return;
+				case node_type::node48:
+					if (node->_count <= 12)
+						_resize(slot, node_type::node16);
+					return;
+				default:
+					if (node->_count <= 37)
+						_resize(slot, node_type::node48);
+			}
+		}
+
+		static leaf_type* _min_leaf(node_type* node) {
+			while (!node_type::is_leaf(node))
+				node = node->first_child();
+			return node_type::leaf<leaf_type>(node);
+		}
+
+		static leaf_type* _max_leaf(node_type* node) {
+			while (!node_type::is_leaf(node))
+				node = node->last_child();
+			return node_type::leaf<leaf_type>(node);
+		}
+
+	/** byte 'i' of the prefix of 'node', found at 'depth': kept in the node
+	 *	or read from a key below */
+		static unsigned char _prefix_byte(node_type* node, size_type depth, size_type i) {
+			if (i < node_type::max_prefix)
+				return node->_prefix[i];
+			return traits_type::byte(_min_leaf(node)->_data.first, depth + i);
+		}
+
+	/** first prefix byte of 'node' where 'k' differs, or _prefix_len */
+		static size_type _mismatch(node_type* node, const key_type& k, size_type depth) {
+			size_type i = 0;
+			for (; i < node->_prefix_len && i < node_type::max_prefix; ++i)
+				if (node->_prefix[i] != traits_type::byte(k, depth + i))
+					return i;
+			if (i == node->_prefix_len)
+				return i;
+			const key_type& below = _min_leaf(node)->_data.first;
+			for (; i < node->_prefix_len; ++i)
+				if (traits_type::byte(below, depth + i) != traits_type::byte(k, depth + i))
+					return i;
+			return i;
+		}
+
+		static void _set_prefix(node_type* node, const key_type& k, size_type depth, size_type len) {
+			node->_prefix_len = len;
+			for (size_type i = 0; i < len && i < node_type::max_prefix; ++i)
+				node->_prefix[i] = traits_type::byte(k, depth + i);
+		}
+
+	/** drops the first 'n' bytes of the prefix of 'node', found at 'depth' */
+		static void _cut_prefix(node_type* node, size_type depth, size_type n) {
+			size_type len = node->_prefix_len - n;
+			if (node->_prefix_len <= node_type::max_prefix)
+				std::memmove(node->_prefix, node->_prefix + n, len);
+			else
+				_set_prefix(node, _min_leaf(node)->_data.first, depth + n, len);
+			node->_prefix_len = len;
+		}
+
+	/** @brief First leaf whose first 'n' key bytes are not below those of 'k'
+	 *	('upper': above them), the header if none. Every byte is checked, the
+	 *	ones a prefix does not keep through a leaf below. Where the descent
+	 *	leaves the key's path, the whole subtree is above or below it. */
+		leaf_type* _bound(const key_type& k, size_type n, bool upper) const {
+			node_type*	node = _root;
+			size_type		depth = 0;
+
+			if (node == NULL)
+				return _header;
+			while (true) {
+				if (node_type::is_leaf(node)) {
+					leaf_type* leaf = node_type::leaf<leaf_type>(node);
+					for (size_type p = depth; p < n; ++p) {
+						unsigned char a = traits_type::byte(leaf->_data.first, p);
+						unsigned char b = traits_type::byte(k, p);
+						if (a != b)
+							return a > b ? leaf : leaf->_next;
+					}
+					return upper ? leaf->_next : leaf;
+				}
+				for (size_type i = 0; i < node->_prefix_len; ++i) {
+					if (depth + i >= n)
+						return upper ? _max_leaf(node)->_next : _min_leaf(node);
+					unsigned char a = _prefix_byte(node, depth, i);
+					unsigned char b = traits_type::byte(k, depth + i);
+					if (a != b)
+						return a > b ? _min_leaf(node) : _max_leaf(node)->_next;
+				}
+				depth += node->_prefix_len;
+				if (depth >= n)
+					return upper ? _max_leaf(node)->_next : _min_leaf(node);
+				unsigned char b = traits_type::byte(k, depth);
+				node_type** child = node->find_child(b);
+				if (!child) {
+					node_type* above = node->child_above(b);
+					return above ? _min_leaf(above) : _max_leaf(node)->_next;
+				}
+				node = *child;
+				++depth;
+			}
+		}
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+	template <class Key, class T, class Alloc>
+	bool operator == (const art_map<Key, T, Alloc>& lhs, const art_map<Key, T, Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+	template <class Key, class T, class Alloc>
+	bool operator != (const art_map<Key, T, Alloc>& lhs, const art_map<Key, T, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+	template <class Key, class T, class Alloc>
+	bool operator < (const art_map<Key, T, Alloc>& lhs, const art_map<Key, T, Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <class Key, class T, class Alloc>
+	bool operator <= (const art_map<Key, T, Alloc>& lhs, const art_map<Key, T, Alloc>& rhs) {
+		return !(rhs < lhs); }
+
+	template <class Key, class T, class Alloc>
+	bool operator > (const art_map<Key, T, Alloc>& lhs, const art_map<Key, T, Alloc>& rhs) {
+		return rhs < lhs; }
+
+	template <class Key, class T, class Alloc>
+	bool operator >= (const art_map<Key, T, Alloc>& lhs, const art_map<Key, T, Alloc>& rhs) {
+		return !(lhs < rhs); }
+
+	template <class Key, class T, class Alloc>
+	void swap (art_map<Key, T, Alloc>& lhs, art_map<Key, T, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,559 @@
+#ifndef _BTREE_MAP_HPP_
+#define _BTREE_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <new>
+#include "../inc/pair.hpp"
+#include "../inc/btree_node.hpp"
+#include "../inc/btree_iterator.hpp"
+#include "../inc/reverse_iterator.hpp"
+#include "../inc/lex_compare.hpp"
+
+namespace ft {
+
+	/*---------------*/
+ /**	BTREE:MAP:  */
+/*---------------*/
+
+/**	@brief Same interface as ft::map on a B+tree: elements live in leaves
+ *	of some 512 bytes (ft::btree_traits) chained in key order, inner nodes
+ *	only route. A lookup touches one node per level, a few dozen keys
+ *	packed together, instead of one scattered node per comparison.
+ *	Unlike ft::map, insert and erase shift elements inside and across
+ *	leaves: they invalidate iterators, as they would for ft::vector.
+ *	Appending in key order fills leaves completely. */
+template <class Key,
+					class T,
+					class Compare = std::less<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class btree_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef Compare														key_compare;
+
+/** @value_compare: compares the key of objects of type btree_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class btree_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::reference																					reference;
+		typedef typename Alloc::const_reference																		const_reference;
+		typedef typename Alloc::pointer																						pointer;
+		typedef typename Alloc::const_pointer																			const_pointer;
+		typedef ft::btree_traits<Key, value_type>																	traits_type;
+		typedef ft::btree_node_base																								node_base;
+		typedef ft::btree_leaf<Key, value_type, traits_type::leaf_slots>					leaf_type;
+		typedef ft::btree_inner<Key, traits_type::inner_slots>										inner_type;
+		typedef typename Alloc::template rebind<leaf_type>::other									leaf_allocator_type;
+		typedef typename Alloc::template rebind<inner_type>::other								inner_allocator_type;
+		typedef ft::btree_iterator<value_type, leaf_type>													iterator;
+		typedef ft::btree_iterator<const value_type, leaf_type>										const_iterator;
+		typedef ft::reverse_iterator<iterator>																		reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>															const_reverse_iterator;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+		typedef ft::btree_search<Key, Compare>		search_type;
+
+		static const size_type	leaf_slots = traits_type::leaf_slots;
+		static const size_type	inner_slots = traits_type::inner_slots;
+		static const size_type	min_leaf = leaf_slots / 2;								// elements
+		static const size_type	min_inner = (inner_slots + 1) / 2 - 1;		// keys
+		static const size_type	max_depth = 64;
+
+	/** inner nodes crossed by a descent and the child taken in each */
+		struct path {
+			inner_type*	nodes[max_depth];
+			size_type		slots[max_depth];
+			size_type		depth;
+		};
+
+		node_base*						_root;			// NULL when empty
+		leaf_type*						_header;		// empty leaf closing the ring of leaves: end()
+		size_type							_size;
+		Compare								_comp;
+		allocator_type				_alloc;
+		leaf_allocator_type		_leaf_alloc;
+		inner_allocator_type	_inner_alloc;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit btree_map (const key_compare& comp = key_compare(),
+												const allocator_type& alloc = allocator_type()) :
+		_root(NULL), _header(NULL), _size(0), _comp(comp), _alloc(alloc), _leaf_alloc(alloc), _inner_alloc(alloc) {
+			_header = _new_leaf(NULL);
+		}
+
+		template <class InputIterator>
+		btree_map (InputIterator first, InputIterator last,
+							const key_compare& comp = key_compare(),
+							const allocator_type& alloc = allocator_type()) :
+		_root(NULL), _header(NULL), _size(0), _comp(comp), _alloc(alloc), _leaf_alloc(alloc), _inner_alloc(alloc) {
+			_header = _new_leaf(NULL);
+			insert(first, last);
+		}
+
+		btree_map (const btree_map& x) :
+		_root(NULL), _header(NULL), _size(0), _comp(x._comp), _alloc(x._alloc), _leaf_alloc(x._alloc), _inner_alloc(x._alloc) {
+			_header = _new_leaf(NULL);
+			insert(x.begin(), x.end());
+		}
+
+/**	DESTRUCTOR: 	*/
+		~btree_map() {
+			clear();
+			_leaf_alloc.destroy(_header);
+			_leaf_alloc.deallocate(_header, 1);
+		}
+
+		btree_map& operator= (const btree_map& x) {
+			if (this == &x) return *this;
+			clear();
+			_comp = x._comp;
+			insert(x.begin(), x.end());
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		iterator begin() { return iterator(_header->_next, 0); }
+		const_iterator begin() const { return const_iterator(_header->_next, 0); }
+		iterator end() { return iterator(_header, 0); }
+		const_iterator end() const { return const_iterator(_header, 0); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _size == 0; }
+		size_type size() const { return _size; }
+		size_type max_size() const { return _alloc.max_size(); }
+
+/** ELEMENT:ACCESS:	***/
+		mapped_type& operator[] (const key_type& k) {
+			return (*(insert(ft::make_pair(k, mapped_type())).first)).second;
+		}
+
+		mapped_type& at (const key_type& k) {
+			iterator it = find(k);
+			if (it == end()) throw std::out_of_range("btree_map::at: out of range");
+			return it->second;
+		}
+
+		const mapped_type& at (const key_type& k) const {
+			const_iterator it = find(k);
+			if (it == end()) throw std::out_of_range("btree_map::at: out of range");
+			return it->second;
+		}
+
+/** MODIFIERS:	***/
+		pair<iterator, bool> insert (const value_type& val) {
+			if (_root == NULL) {
+				leaf_type* leaf = _new_leaf(_header);
+				leaf->insert(0, val);
+				_root = leaf;
+				++_size;
+				return ft::make_pair(iterator(leaf, 0), true);
+			}
+			path p;
+			leaf_type* leaf = _descend(val.first, &p);
+			size_type pos = search_type::lower(leaf->keys(), leaf->_count, val.first, _comp);
+			if (pos < leaf->_count && !_comp(val.first, leaf->key(pos)))
+				return ft::make_pair(iterator(leaf, pos), false);
+
+			++_size;
+			if (leaf->_count < leaf_slots) {
+				leaf->insert(pos, val);
+				return ft::make_pair(iterator(leaf, pos), true);
+			}
+		/** full leaf: split in halves, or start a new leaf when appending past the last key */
+			bool to_left = pos <= leaf_slots / 2;
+			size_type split = to_left ? leaf_slots / 2 : leaf_slots / 2 + 1;
+			if (pos == leaf_slots && leaf->_next == _header)
+				split = leaf_slots;
+			leaf_type* right = _new_leaf(leaf);
+			right->append_from(*leaf, split);
+			leaf_type* target = to_left ? leaf : right;
+			size_type at = to_left ? pos : pos - split;
+			target->insert(at, val);
+			_insert_inner(p, p.depth, right->key(0), right);
+			return ft::make_pair(iterator(target, at), true);
+		}
+
+		iterator insert (iterator, const value_type& val) { return insert(val).first; }
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		void erase (iterator position) {
+			if (position == end()) return;
+			key_type k(position->first);
+			_erase(k);
+		}
+
+		size_type erase (const key_type& k) { return _erase(k); }
+
+	/** elements move as others are erased: the range is followed by key */
+		void erase (iterator first, iterator last) {
+			if (first == begin() && last == end()) {
+				clear();
+				return;
+			}
+			if (last == end()) {
+				while (first != end()) {
+					key_type k(first->first);
+					_erase(k);
+					first = lower_bound(k);
+				}
+				return;
+			}
+			key_type stop(last->first);
+			while (_comp(first->first, stop)) {
+				key_type k(first->first);
+				_erase(k);
+				first = lower_bound(k);
+			}
+		}
+
+	/** the header leaf moves with the elements, so iterators stay valid */
+		void swap (btree_map& x) {
+			node_base* root = _root;
+			_root = x._root;
+			x._root = root;
+
+			leaf_type* header = _header;
+			_header = x._header;
+			x._header = header;
+
+			size_type size = _size;
+			_size = x._size;
+			x._size = size;
+
+			Compare comp = _comp;
+			_comp = x._comp;
+			x._comp = comp;
+
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+
+			leaf_allocator_type leaf_alloc = _leaf_alloc;
+			_leaf_alloc = x._leaf_alloc;
+			x._leaf_alloc = leaf_alloc;
+
+			inner_allocator_type inner_alloc = _inner_alloc;
+			_inner_alloc = x._inner_alloc;
+			x._inner_alloc = inner_alloc;
+		}
+
+		void clear() {
+			if (_root)
+				_destroy(_root);
+			_root = NULL;
+			_size = 0;
+			_header->_prev = _header;
+			_header->_next = _header;
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return _comp; }
+		value_compare value_comp() const { return value_compare(_comp); }
+
+/** OPERATIONS:	***/
+		iterator find (const key_type& k) {
+			if (_root == NULL) return end();
+			leaf_type* leaf = _descend(k, NULL);
+			size_type pos = search_type::lower(leaf->keys(), leaf->_count, k, _comp);
+			if (pos == leaf->_count || _comp(k, leaf->key(pos)))
+				return end();
+			return iterator(leaf, pos);
+		}
+
+		const_iterator find (const key_type& k) const { return const_cast<btree_map*>(this)->find(k); }
+
+		size_type count (const key_type& k) const { return find(k) != end(); }
+
+		iterator lower_bound (const key_type& k) {
+			if (_root == NULL) return end();
+			leaf_type* leaf = _descend(k, NULL);
+			return _at(leaf, search_type::lower(leaf->keys(), leaf->_count, k, _comp));
+		}
+
+		const_iterator lower_bound (const key_type& k) const { return const_cast<btree_map*>(this)->lower_bound(k); }
+
+		iterator upper_bound (const key_type& k) {
+			if (_root == NULL) return end();
+			leaf_type* leaf = _descend(k, NULL);
+			return _at(leaf, search_type::upper(leaf->keys(), leaf->_count, k, _comp));
+		}
+
+		const_iterator upper_bound (const key_type& k) const { return const_cast<btree_map*>(this)->upper_bound(k); }
+
+		pair<iterator, iterator> equal_range (const key_type& k) {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+	/** a new empty leaf, linked after 'prev' (none for the header) */
+		leaf_type* _new_leaf(leaf_type* prev) {
+			leaf_type* leaf = _leaf_alloc.allocate(1);
+			new (static_cast<void*>(leaf)) leaf_type();
+			if (prev)
+				leaf->link_after(prev);
+			return leaf;
+		}
+
+		inner_type* _new_inner() {
+			inner_type* inner = _inner_alloc.allocate(1);
+			new (static_cast<void*>(inner)) inner_type();
+			return inner;
+		}
+
+		void _delete_leaf(leaf_type* leaf) {
+			leaf->unlink();
+			leaf->clear();
+			_leaf_alloc.destroy(leaf);
+			_leaf_alloc.deallocate(leaf, 1);
+		}
+
+		void _delete_inner(inner_type* inner) {
+			_inner_alloc.destroy(inner);
+			_inner_alloc.deallocate(inner, 1);
+		}
+
+	/** frees a whole subtree; the ring is reset by the caller */
+		void _destroy(node_base* node) {
+			if (node->_leaf) {
+				leaf_type* leaf = static_cast<leaf_type*>(node);
+				leaf->clear();
+				_leaf_alloc.destroy(leaf);
+				_leaf_alloc.deallocate(leaf, 1);
+				return;
+			}
+			inner_type* inner = static_cast<inner_type*>(node);
+			for (size_type i = 0; i <= inner->_count; ++i)
+				_destroy(inner->_children[i]);
+			for (size_type i = 0; i < inner->_count; ++i)
+				inner->destroy_key(i);
+			_delete_inner(inner);
+		}
+
+	/** slot 'pos' of 'leaf', or the first slot of the next leaf when past its end */
+		iterator _at(leaf_type* leaf, size_type pos) const {
+			if (pos == leaf->_count)
+				return iterator(leaf->_next, 0);
+			return iterator(leaf, pos);
+		}
+
+	/** the leaf that holds or would hold 'k'; records the way down in 'p' */
+		leaf_type* _descend(const key_type& k, path* p) const {
+			node_base* node = _root;
+			size_type depth = 0;
+			while (!node->_leaf) {
+				inner_type* inner = static_cast<inner_type*>(node);
+				size_type i = search_type::upper(inner->keys(), inner->_count, k, _comp);
+				if (p) {
+					p->nodes[depth] = inner;
+					p->slots[depth] = i;
+				}
+				++depth;
+				node = inner->_children[i];
+			}
+			if (p)
+				p->depth = depth;
+			return static_cast<leaf_type*>(node);
+		}
+
+	/** hangs 'node' right of 'k' in the parent at 'depth' of the path,
+	 *	splitting full inner nodes up to a new root if needed */
+		void _insert_inner(const path& p, size_type depth, const key_type& k, node_base* node) {
+			if (depth == 0) {
+				inner_type* root = _new_inner();
+				root->_children[0] = _root;
+				root->push_back(k, node);
+				_root = root;
+				return;
+			}
+			inner_type* parent = p.nodes[depth - 1];
+			size_type pos = p.slots[depth - 1];
+			if (parent->_count < inner_slots - 1) {
+				parent->insert(pos, k, node);
+				return;
+			}
+		/** full: the median of the keys with 'k' among them moves up */
+			size_type median = (parent->_count + 1) / 2;
+			inner_type* right = _new_inner();
+			if (pos == median) {
+				parent->split(median, *right);
+				right->_children[0] = node;
+				_insert_inner(p, depth - 1, k, right);
+				return;
+			}
+			size_type mid = pos < median ? median - 1 : median;
+			parent->split(mid + 1, *right);
+			key_type up(parent->key(mid));
+			parent->pop_back();
+			if (pos < median)
+				parent->insert(pos, k, node);
+			else
+				right->insert(pos - mid - 1, k, node);
+			_insert_inner(p, depth - 1, up, right);
+		}
+
+		size_type _erase(const key_type& k) {
+			if (_root == NULL) return 0;
+			path p;
+			leaf_type* leaf = _descend(k, &p);
+			size_type pos = search_type::lower(leaf->keys(), leaf->_count, k, _comp);
+			if (pos == leaf->_count || _comp(k, leaf->key(pos)))
+				return 0;
+			leaf->erase(pos);
+			--_size;
+
+			if (p.depth == 0) {
+				if (leaf->_count == 0) {
+					_delete_leaf(leaf);
+					_root = NULL;
+				}
+				return 1;
+			}
+			if (leaf->_count >= min_leaf)
+				return 1;
+		/** underflow: borrow from a sibling that can spare an element, else merge */
+			inner_type* parent = p.nodes[p.depth - 1];
+			size_type i = p.slots[p.depth - 1];
+			leaf_type* left = i > 0 ? static_cast<leaf_type*>(parent->_children[i - 1]) : NULL;
+			leaf_type* right = i < parent->_count ? static_cast<leaf_type*>(parent->_children[i + 1]) : NULL;
+			if (left && left->_count > min_leaf) {
+				leaf->insert(0, left->value(left->_count - 1));
+				left->erase(left->_count - 1);
+				parent->set_key(i - 1, leaf->key(0));
+			}
+			else if (right && right->_count > min_leaf) {
+				leaf->insert(leaf->_count, right->value(0));
+				right->erase(0);
+				parent->set_key(i, right->key(0));
+			}
+			else if (left) {
+				left->append_from(*leaf, 0);
+				_delete_leaf(leaf);
+				parent->erase(i - 1);
+				_rebalance_inner(p, p.depth - 1);
+			}
+			else {
+				leaf->append_from(*right, 0);
+				_delete_leaf(right);
+				parent->erase(i);
+				_rebalance_inner(p, p.depth - 1);
+			}
+			return 1;
+		}
+
+	/** the inner node at 'depth' of the path lost a key: same borrow or merge
+	 *	one level up, through the parent's separator; an empty root goes away */
+		void _rebalance_inner(const path& p, size_type depth) {
+			inner_type* node = p.nodes[depth];
+			if (depth == 0) {
+				if (node->_count == 0) {
+					_root = node->_children[0];
+					_delete_inner(node);
+				}
+				return;
+			}
+			if (node->_count >= min_inner)
+				return;
+			inner_type* parent = p.nodes[depth - 1];
+			size_type i = p.slots[depth - 1];
+			inner_type* left = i > 0 ? static_cast<inner_type*>(parent->_children[i - 1]) : NULL;
+			inner_type* right = i < parent->_count ? static_cast<inner_type*>(parent->_children[i + 1]) : NULL;
+			if (left && left->_count > min_inner) {
+				node->push_front(parent->key(i - 1), left->_children[left->_count]);
+				parent->set_key(i - 1, left->key(left->_count - 1));
+				left->pop_back();
+			}
+			else if (right && right->_count > min_inner) {
+				node->push_back(parent->key(i), right->_children[0]);
+				parent->set_key(i, right->key(0));
+				right->pop_front();
+			}
+			else if (left) {
+				left->merge(parent->key(i - 1), *node);
+				_delete_inner(node);
+				parent->erase(i - 1);
+				_rebalance_inner(p, depth - 1);
+			}
+			else {
+				node->merge(parent->key(i), *right);
+				_delete_inner(right);
+				parent->erase(i);
+				_rebalance_inner(p, depth - 1);
+			}
+		}
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator == (const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator != (const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator < (const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator <= (const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs) {
+		return !(rhs < lhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator > (const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs) {
+		return rhs < lhs; }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator >= (const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs < rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (btree_map<Key, T, Compare, Alloc>& lhs, btree_map<Key, T, Compare, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,788 @@
+#ifndef _COMPACT_MAP_HPP_
+#define _COMPACT_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <stdint.h>
+#include "vector.hpp"
+#include "../inc/pair.hpp"
+#include "../inc/compact_iterator.hpp"
+#include "../inc/reverse_iterator.hpp"
+#include "../inc/lex_compare.hpp"
+
+namespace ft {
+
+	/*------------------*/
+ /**	COMPACT:NODE:  */
+/*------------------*/
+
+/**	@brief Node of ft::compact_map: the element and three 32-bit indices
+ *	into the node vector instead of three pointers and an int height.
+ *	The AVL balance factor lives in the top bit of each child link
+ *	(left-heavy / right-heavy), which caps the map at 2^31 - 1 elements.
+ *	Slot 0 is the header: its _parent is the root, _left the leftmost
+ *	and _right the rightmost index; index 0 doubles as "no child". */
+	template <class T>
+	struct CNode {
+
+		typedef T					value_type;
+		typedef uint32_t	index_type;
+
+		static const index_type	heavy = 0x80000000u;
+		static const index_type	mask = 0x7fffffffu;
+		static const index_type	vacant = 0xffffffffu;		// _left of an erased slot
+
+		value_type	_data;
+		index_type	_left;			// top bit: the left subtree is the taller one
+		index_type	_right;			// top bit: the right subtree is the taller one
+		index_type	_parent;
+
+		explicit CNode(const value_type& data) : _data(data), _left(0), _right(0), _parent(0) {}
+
+		index_type left() const { return _left & mask; }
+		index_type right() const { return _right & mask; }
+		void set_left(index_type i) { _left = (_left & heavy) | i; }
+		void set_right(index_type i) { _right = (_right & heavy) | i; }
+
+		// height(right) - height(left): -1, 0 or 1
+		int balance() const { return int(_right >> 31) - int(_left >> 31); }
+		void set_balance(int b) {
+			_left = left() | (b < 0 ? heavy : 0);
+			_right = right() | (b > 0 ? heavy : 0);
+		}
+
+		template <class Storage>
+		static index_type minimum(const Storage& nodes, index_type i) {
+			while (nodes[i].left())
+				i = nodes[i].left();
+			return i;
+		}
+
+		template <class Storage>
+		static index_type maximum(const Storage& nodes, index_type i) {
+			while (nodes[i].right())
+				i = nodes[i].right();
+			return i;
+		}
+
+	/** next index in order; climbing past the root lands on 0, the header (end) */
+		template <class Storage>
+		static index_type increment(const Storage& nodes, index_type i) {
+			if (nodes[i].right())
+				return minimum(nodes, nodes[i].right());
+			index_type parent = nodes[i]._parent;
+			while (parent && i == nodes[parent].right()) {
+				i = parent;
+				parent = nodes[parent]._parent;
+			}
+			return parent;
+		}
+
+	/** previous index in order; the header steps onto the rightmost node */
+		template <class Storage>
+		static index_type decrement(const Storage& nodes, index_type i) {
+			if (i == 0)
+				return nodes[0]._right;
+			if (nodes[i].left())
+				return maximum(nodes, nodes[i].left());
+			index_type parent = nodes[i]._parent;
+			while (parent && i == nodes[parent].left()) {
+				i = parent;
+				parent = nodes[parent]._parent;
+			}
+			return parent;
+		}
+	};
+
+	/*--------------------*/
+ /**	COMPACT:STORAGE:  */
+/*--------------------*/
+
+/**	@brief Node slots of ft::compact_map, in fixed-size chunks reached
+ *	through a table: slot i is slot i % chunk_size of chunk i / chunk_size.
+ *	A chunk is never moved nor freed before the storage, so growing it
+ *	leaves every node, and every reference into one, where it was.
+ *	A vacant slot (erased, its element destroyed) only keeps its links,
+ *	_left set to Node::vacant. */
+	template <class Node, class Alloc>
+	class compact_storage {
+
+	public:
+		typedef Node																					value_type;
+		typedef typename Node::index_type											index_type;
+		typedef std::size_t																		size_type;
+		typedef typename Alloc::template rebind<Node*>::other	table_allocator_type;
+
+		static const size_type	chunk_bits = 8;
+		static const size_type	chunk_size = size_type(1) << chunk_bits;
+
+	private:
+		ft::vector<Node*, table_allocator_type>	_chunks;
+		size_type																_size;
+		Alloc																		_alloc;
+
+	public:
+		explicit compact_storage(const Alloc& alloc) : _chunks(table_allocator_type(alloc)), _size(0), _alloc(alloc) {}
+
+		compact_storage(const compact_storage& x) :
+		_chunks(table_allocator_type(x._alloc)), _size(0), _alloc(x._alloc) {
+			try {
+				_assign(x);
+			}
+			catch (...) {
+				_release();
+				throw;
+			}
+		}
+
+		~compact_storage() { _release(); }
+
+	/** keeps the chunks and the allocator */
+		compact_storage& operator= (const compact_storage& x) {
+			if (this != &x) {
+				clear();
+				_assign(x);
+			}
+			return *this;
+		}
+
+		Node& operator[] (size_type i) const { return _chunks[i >> chunk_bits][i & (chunk_size - 1)]; }
+
+		size_type size() const { return _size; }
+		size_type capacity() const { return _chunks.size() * chunk_size; }
+
+	/** chunks for 'n' slots */
+		void reserve(size_type n) {
+			while (capacity() < n) {
+				_chunks.reserve(_chunks.size() + 1);
+				_chunks.push_back(_alloc.allocate(chunk_size));
+			}
+		}
+
+		void push_back(const Node& node) {
+			reserve(_size + 1);
+			_alloc.construct(&(*this)[_size], node);
+			++_size;
+		}
+
+	/** destroys every element, keeps the chunks */
+		void clear() {
+			for (; _size; --_size) {
+				Node& node = (*this)[_size - 1];
+				if (node._left != Node::vacant)
+					_alloc.destroy(&node);
+			}
+		}
+
+	private:
+	/** copies the elements of 'x', and the links of its vacant slots */
+		void _assign(const compact_storage& x) {
+			reserve(x._size);
+			for (; _size < x._size; ++_size) {
+				const Node& from = x[_size];
+				Node& to = (*this)[_size];
+				if (from._left == Node::vacant) {
+					to._left = Node::vacant;
+					to._parent = from._parent;
+				}
+				else
+					_alloc.construct(&to, from);
+			}
+		}
+
+		void _release() {
+			clear();
+			for (size_type i = 0; i < _chunks.size(); ++i)
+				_alloc.deallocate(_chunks[i], chunk_size);
+			_chunks.clear();
+		}
+	};
+
+	/*-----------------*/
+ /**	COMPACT:MAP:  */
+/*-----------------*/
+
+/**	@brief Same interface and iterators as ft::map, with the nodes kept
+ *	in chunks of contiguous slots (compact_storage) and linked by 32-bit
+ *	indices: an ft::compact_map<int, int> node is 20 bytes against 40 (plus
+ *	heap overhead) for ft::map, and nodes allocated together stay together.
+ *	The parent index is kept: iterators and the bottom-up rebalancing need it.
+ *	Chunks never move, and erased slots go to a free list reused by the
+ *	next insertions, so inserting and erasing never move an element:
+ *	iterators and references stay valid as with ft::map. Erasing destroys
+ *	the element at once. */
+template <class Key,
+					class T,
+					class Compare = std::less<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class compact_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef Compare														key_compare;
+
+/** @value_compare: compares the key of objects of type compact_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class compact_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::reference																					reference;
+		typedef typename Alloc::const_reference																		const_reference;
+		typedef typename Alloc::pointer																						pointer;
+		typedef typename Alloc::const_pointer																			const_pointer;
+		typedef ft::CNode<value_type>																							node_type;
+		typedef typename node_type::index_type																		index_type;
+		typedef typename Alloc::template rebind<node_type>::other									node_allocator_type;
+		typedef ft::compact_storage<node_type, node_allocator_type>								storage_type;
+		typedef ft::compact_iterator<value_type, storage_type>										iterator;
+		typedef ft::compact_iterator<const value_type, storage_type>							const_iterator;
+		typedef ft::reverse_iterator<iterator>																		reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>															const_reverse_iterator;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+		storage_type*		_nodes;			// slot 0 is the header
+		index_type			_free;			// first erased slot, chained through _parent
+		size_type				_size;
+		Compare					_comp;
+		allocator_type	_alloc;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit compact_map (const key_compare& comp = key_compare(),
+													const allocator_type& alloc = allocator_type()) :
+		_nodes(NULL), _free(0), _size(0), _comp(comp), _alloc(alloc) {
+			_init_storage();
+		}
+
+		template <class InputIterator>
+		compact_map (InputIterator first, InputIterator last,
+								const key_compare& comp = key_compare(),
+								const allocator_type& alloc = allocator_type()) :
+		_nodes(NULL), _free(0), _size(0), _comp(comp), _alloc(alloc) {
+			_init_storage();
+			insert(first, last);
+		}
+
+	/** indices are slot numbers: copying the storage copies the tree */
+		compact_map (const compact_map& x) :
+		_nodes(new storage_type(*x._nodes)), _free(x._free), _size(x._size), _comp(x._comp), _alloc(x._alloc) {}
+
+/**	DESTRUCTOR: 	*/
+		~compact_map() { delete _nodes; }
+
+		compact_map& operator= (const compact_map& x) {
+			if (this == &x) return *this;
+			*_nodes = *x._nodes;
+			_free = x._free;
+			_size = x._size;
+			_comp = x._comp;
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		iterator begin() { return iterator(_nodes, _node(0)._left); }
+		const_iterator begin() const { return const_iterator(_nodes, _node(0)._left); }
+		iterator end() { return iterator(_nodes, 0); }
+		const_iterator end() const { return const_iterator(_nodes, 0); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _size == 0; }
+		size_type size() const { return _size; }
+		size_type max_size() const { return node_type::mask - 1; }
+
+	/** room for 'n' elements without adding a chunk */
+		void reserve(size_type n) {
+			if (n + 1 > _nodes->capacity())
+				_nodes->reserve(n + 1);
+		}
+
+/** ELEMENT:ACCESS:	***/
+		mapped_type& operator[] (const key_type& k) {
+			return (*(insert(ft::make_pair(k, mapped_type())).first)).second;
+		}
+
+		mapped_type& at (const key_type& k) {
+			iterator it = find(k);
+			if (it == end()) throw std::out_of_range("compact_map::at: out of range");
+			return it->second;
+		}
+
+		const mapped_type& at (const key_type& k) const {
+			const_iterator it = find(k);
+			if (it == end()) throw std::out_of_range("compact_map::at: out of range");
+			return it->second;
+		}
+
+/** MODIFIERS:	***/
+		pair<iterator, bool> insert (const value_type& val) {
+			index_type parent = 0;
+			index_type x = _root();
+			bool left = true;
+			while (x) {
+				parent = x;
+				if (_comp(val.first, _node(x)._data.first)) {
+					left = true;
+					x = _node(x).left();
+				}
+				else if (_comp(_node(x)._data.first, val.first)) {
+					left = false;
+					x = _node(x).right();
+				}
+				else
+					return ft::make_pair(iterator(_nodes, x), false);
+			}
+			index_type node = _create_node(val);
+			_link(node, parent, left);
+			return ft::make_pair(iterator(_nodes, node), true);
+		}
+
+	/** O(1) before rebalancing when 'val' goes right before 'pos', as with
+	 *	ft::map; any other hint falls back to insert(val) */
+		iterator insert (iterator pos, const value_type& val) {
+			index_type hint = pos._index;
+			index_type prev = node_type::decrement(*_nodes, hint);
+			if (_size == 0 || (hint != _node(0)._left && !_comp(_node(prev)._data.first, val.first))
+					|| (hint != 0 && !_comp(val.first, _node(hint)._data.first)))
+				return insert(val).first;
+
+			index_type node = _create_node(val);
+			if (hint == 0)
+				_link(node, _node(0)._right, false);
+			else if (_node(hint).left() == 0)
+				_link(node, hint, true);
+			else
+				_link(node, prev, false);
+			return iterator(_nodes, node);
+		}
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		void erase (iterator position) {
+			if (position._index != 0)
+				_erase(position._index);
+		}
+
+		size_type erase (const key_type& k) {
+			index_type i = _find(k);
+			if (i == 0) return 0;
+			_erase(i);
+			return 1;
+		}
+
+		void erase (iterator first, iterator last) {
+			while (first != last)
+				erase(first++);
+		}
+
+	/** the node storage moves with the elements, so iterators stay valid */
+		void swap (compact_map& x) {
+			storage_type* nodes = _nodes;
+			_nodes = x._nodes;
+			x._nodes = nodes;
+
+			index_type free = _free;
+			_free = x._free;
+			x._free = free;
+
+			size_type size = _size;
+			_size = x._size;
+			x._size = size;
+
+			Compare comp = _comp;
+			_comp = x._comp;
+			x._comp = comp;
+
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+		}
+
+	/** keeps the chunks for the next elements */
+		void clear() {
+			_nodes->clear();
+			_nodes->push_back(node_type(value_type()));
+			_free = 0;
+			_size = 0;
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return _comp; }
+		value_compare value_comp() const { return value_compare(_comp); }
+
+/** OPERATIONS:	***/
+		iterator find (const key_type& k) { return iterator(_nodes, _find(k)); }
+		const_iterator find (const key_type& k) const { return const_iterator(_nodes, _find(k)); }
+
+		size_type count (const key_type& k) const { return _find(k) != 0; }
+
+		iterator lower_bound (const key_type& k) { return iterator(_nodes, _lower_bound(k)); }
+		const_iterator lower_bound (const key_type& k) const { return const_iterator(_nodes, _lower_bound(k)); }
+		iterator upper_bound (const key_type& k) { return iterator(_nodes, _upper_bound(k)); }
+		const_iterator upper_bound (const key_type& k) const { return const_iterator(_nodes, _upper_bound(k)); }
+
+		pair<iterator, iterator> equal_range (const key_type& k) {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+		node_type& _node(index_type i) const { return (*_nodes)[i]; }
+		index_type& _root() const { return _node(0)._parent; }
+
+		void _init_storage() {
+			_nodes = new storage_type(node_allocator_type(_alloc));
+			_nodes->push_back(node_type(value_type()));
+		}
+
+	/** reuses an erased slot, or appends one, in a new chunk if needed */
+		index_type _create_node(const value_type& val) {
+			if (_free) {
+				index_type i = _free;
+				_alloc.construct(&_node(i)._data, val);
+				_free = _node(i)._parent;
+				_node(i)._left = 0;
+				_node(i)._right = 0;
+				return i;
+			}
+			if (_nodes->size() > node_type::mask - 1)
+				throw std::length_error("compact_map: too many elements");
+			_nodes->push_back(node_type(val));
+			return index_type(_nodes->size() - 1);
+		}
+
+	/** hangs a new leaf under 'parent', keeps the header ends and rebalances */
+		void _link(index_type node, index_type parent, bool left) {
+			node_type& header = _node(0);
+			_node(node)._parent = parent;
+			if (parent == 0) {
+				header._parent = node;
+				header._left = node;
+				header._right = node;
+			}
+			else if (left) {
+				_node(parent).set_left(node);
+				if (header._left == parent)
+					header._left = node;
+			}
+			else {
+				_node(parent).set_right(node);
+				if (header._right == parent)
+					header._right = node;
+			}
+			++_size;
+			_insert_retrace(node);
+		}
+
+	/** points the link of 'parent' that held 'old' (the root for the header) at 'node' */
+		void _replace_child(index_type parent, index_type old, index_type node) {
+			if (parent == 0)
+				_root() = node;
+			else if (_node(parent).left() == old)
+				_node(parent).set_left(node);
+			else
+				_node(parent).set_right(node);
+			if (node)
+				_node(node)._parent = parent;
+		}
+
+	/*---------------------*/
+ /**	AVL:BALANCE:BITS:  */
+/*---------------------*/
+	/** the subtree of 'child' grew by one: walk up fixing balance factors,
+	 *	at most one (single or double) rotation restores the height */
+		void _insert_retrace(index_type child) {
+			for (index_type x = _node(child)._parent; x != 0; x = _node(child)._parent) {
+				int b = _node(x).balance();
+				if (child == _node(x).right()) {
+					if (b > 0) {
+						index_type parent = _node(x)._parent;
+						index_type n = _node(child).balance() < 0 ? _rotate_right_left(x, child) : _rotate_left(x, child);
+						_replace_child(parent, x, n);
+						return;
+					}
+					_node(x).set_balance(b + 1);
+				}
+				else {
+					if (b < 0) {
+						index_type parent = _node(x)._parent;
+						index_type n = _node(child).balance() > 0 ? _rotate_left_right(x, child) : _rotate_right(x, child);
+						_replace_child(parent, x, n);
+						return;
+					}
+					_node(x).set_balance(b - 1);
+				}
+				if (b != 0)		// was heavy on the other side: now even, height unchanged
+					return;
+				child = x;
+			}
+		}
+
+	/** the 'left' (or right) subtree of 'x' shrank by one: walk up,
+	 *	rotating where needed, until a subtree keeps its height */
+		void _erase_retrace(index_type x, bool left) {
+			while (x != 0) {
+				index_type parent = _node(x)._parent;
+				bool x_left = parent != 0 && _node(parent).left() == x;
+				int b = _node(x).balance();
+				if (left ? b > 0 : b < 0) {
+					index_type z = left ? _node(x).right() : _node(x).left();
+					int bz = _node(z).balance();
+					index_type n;
+					if (left)
+						n = bz < 0 ? _rotate_right_left(x, z) : _rotate_left(x, z);
+					else
+						n = bz > 0 ? _rotate_left_right(x, z) : _rotate_right(x, z);
+					_replace_child(parent, x, n);
+					if (bz == 0)
+						return;
+				}
+				else if (b == 0) {
+					_node(x).set_balance(left ? 1 : -1);
+					return;
+				}
+				else
+					_node(x).set_balance(0);
+				left = x_left;
+				x = parent;
+			}
+		}
+
+	/** 'z' is the right child of 'x' */
+		index_type _rotate_left(index_type x, index_type z) {
+			index_type t = _node(z).left();
+			_node(x).set_right(t);
+			if (t) _node(t)._parent = x;
+			_node(z).set_left(x);
+			_node(x)._parent = z;
+			if (_node(z).balance() == 0) {		// only after an erase
+				_node(x).set_balance(1);
+				_node(z).set_balance(-1);
+			}
+			else {
+				_node(x).set_balance(0);
+				_node(z).set_balance(0);
+			}
+			return z;
+		}
+
+	/** 'z' is the left child of 'x' */
+		index_type _rotate_right(index_type x, index_type z) {
+			index_type t = _node(z).right();
+			_node(x).set_left(t);
+			if (t) _node(t)._parent = x;
+			_node(z).set_right(x);
+			_node(x)._parent = z;
+			if (_node(z).balance() == 0) {
+				_node(x).set_balance(-1);
+				_node(z).set_balance(1);
+			}
+			else {
+				_node(x).set_balance(0);
+				_node(z).set_balance(0);
+			}
+			return z;
+		}
+
+	/** 'z' is the right child of 'x' and leans left: its left child 'y' goes up */
+		index_type _rotate_right_left(index_type x, index_type z) {
+			index_type y = _node(z).left();
+			index_type t3 = _node(y).right();
+			_node(z).set_left(t3);
+			if (t3) _node(t3)._parent = z;
+			_node(y).set_right(z);
+			_node(z)._parent = y;
+			index_type t2 = _node(y).left();
+			_node(x).set_right(t2);
+			if (t2) _node(t2)._parent = x;
+			_node(y).set_left(x);
+			_node(x)._parent = y;
+			int b = _node(y).balance();
+			_node(x).set_balance(b > 0 ? -1 : 0);
+			_node(z).set_balance(b < 0 ? 1 : 0);
+			_node(y).set_balance(0);
+			return y;
+		}
+
+	/** 'z' is the left child of 'x' and leans right: its right child 'y' goes up */
+		index_type _rotate_left_right(index_type x, index_type z) {
+			index_type y = _node(z).right();
+			index_type t2 = _node(y).left();
+			_node(z).set_right(t2);
+			if (t2) _node(t2)._parent = z;
+			_node(y).set_left(z);
+			_node(z)._parent = y;
+			index_type t3 = _node(y).right();
+			_node(x).set_left(t3);
+			if (t3) _node(t3)._parent = x;
+			_node(y).set_right(x);
+			_node(x)._parent = y;
+			int b = _node(y).balance();
+			_node(x).set_balance(b < 0 ? 1 : 0);
+			_node(z).set_balance(b > 0 ? -1 : 0);
+			_node(y).set_balance(0);
+			return y;
+		}
+
+		void _erase(index_type z) {
+			node_type& header = _node(0);
+			if (_size == 1) {
+				header._left = 0;
+				header._right = 0;
+			}
+			else if (header._left == z)
+				header._left = node_type::increment(*_nodes, z);
+			else if (header._right == z)
+				header._right = node_type::decrement(*_nodes, z);
+
+			index_type x;				// retracing starts at x, whose 'left' side got shorter
+			bool left;
+			if (!_node(z).left() || !_node(z).right()) {
+				index_type child = _node(z).left() ? _node(z).left() : _node(z).right();
+				x = _node(z)._parent;
+				left = x == 0 || _node(x).left() == z;
+				_replace_child(x, z, child);
+			}
+			// two children: the successor (no left child) is relinked in place of z
+			else {
+				index_type y = node_type::minimum(*_nodes, _node(z).right());
+				if (_node(y)._parent == z) {
+					x = y;
+					left = false;
+				}
+				else {
+					x = _node(y)._parent;
+					left = true;
+					index_type r = _node(y).right();
+					_node(x).set_left(r);
+					if (r) _node(r)._parent = x;
+					_node(y).set_right(_node(z).right());
+					_node(_node(z).right())._parent = y;
+				}
+				_node(y).set_left(_node(z).left());
+				_node(_node(z).left())._parent = y;
+				_node(y).set_balance(_node(z).balance());
+				_replace_child(_node(z)._parent, z, y);
+			}
+			_alloc.destroy(&_node(z)._data);
+			_node(z)._left = node_type::vacant;
+			_node(z)._parent = _free;
+			_free = z;
+			--_size;
+			_erase_retrace(x, left);
+		}
+
+	/** stops on the first match: 0 (end) if k is not in the map */
+		index_type _find(const key_type& k) const {
+			const storage_type& nodes = *_nodes;
+			index_type x = nodes[0]._parent;
+			while (x != 0) {
+				if (_comp(k, nodes[x]._data.first))
+					x = nodes[x].left();
+				else if (_comp(nodes[x]._data.first, k))
+					x = nodes[x].right();
+				else
+					break;
+			}
+			return x;
+		}
+
+	/** first index whose key is not less than k, 0 (end) if none */
+		index_type _lower_bound(const key_type& k) const {
+			const storage_type& nodes = *_nodes;
+			index_type result = 0;
+			for (index_type x = nodes[0]._parent; x != 0; ) {
+				if (_comp(nodes[x]._data.first, k))
+					x = nodes[x].right();
+				else {
+					result = x;
+					x = nodes[x].left();
+				}
+			}
+			return result;
+		}
+
+	/** first index whose key is greater than k, 0 (end) if none */
+		index_type _upper_bound(const key_type& k) const {
+			const storage_type& nodes = *_nodes;
+			index_type result = 0;
+			for (index_type x = nodes[0]._parent; x != 0; ) {
+				if (_comp(k, nodes[x]._data.first)) {
+					result = x;
+					x = nodes[x].left();
+				}
+				else
+					x = nodes[x].right();
+			}
+			return result;
+		}
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator == (const compact_map<Key, T, Compare, Alloc>& lhs, const compact_map<Key, T, Compare, Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator != (const compact_map<Key, T, Compare, Alloc>& lhs, const compact_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator < (const compact_map<Key, T, Compare, Alloc>& lhs, const compact_map<Key, T, Compare, Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator <= (const compact_map<Key, T, Compare, Alloc>& lhs, const compact_map<Key, T, Compare, Alloc>& rhs) {
+		return !(rhs < lhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator > (const compact_map<Key, T, Compare, Alloc>& lhs, const compact_map<Key, T, Compare, Alloc>& rhs) {
+		return rhs < lhs; }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator >= (const compact_map<Key, T, Compare, Alloc>& lhs, const compact_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs < rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (compact_map<Key, T, Compare, Alloc>& lhs, compact_map<Key, T, Compare, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
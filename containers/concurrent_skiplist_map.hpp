@@ -0,0 +1,408 @@
+#ifndef _CONCURRENT_SKIPLIST_MAP_HPP_
+#define _CONCURRENT_SKIPLIST_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <new>
+#include <sched.h>
+#include "../inc/pair.hpp"
+#include "../inc/hash.hpp"
+#include "../inc/atomic.hpp"
+#include "../inc/epoch.hpp"
+#include "../inc/skiplist_node.hpp"
+#include "../inc/skiplist_iterator.hpp"
+
+namespace ft {
+
+	/*------------------------------*/
+ /**	CONCURRENT:SKIPLIST:MAP:    */
+/*------------------------------*/
+
+/**	@brief Ordered map that any number of threads may read and change at
+ *	once: lookups never wait, inserts are lock-free, and an erase may wait
+ *	for an insert of the same element still in flight (below).
+ *	The elements sit in a skip list: every node is on
+ *	level 0, a quarter of them also on level 1, a sixteenth on level 2...
+ *	Links are swung with compare-and-swap. An erase first marks the
+ *	node's level-0 link, which is the moment the element is gone, then its
+ *	upper links; whoever walks past a marked link unlinks the node.
+ *	Erased nodes are retired to an epoch_domain, which frees them once no
+ *	thread can still be reading them.
+ *	Readers (find, count, lower_bound, iteration) never wait and never
+ *	write. Each call is protected on its own; an iterator or reference
+ *	kept past the call stays valid only while the thread holds a guard on
+ *	the map. Iteration sees every element present for the whole walk.
+ *	An erase waits (yielding) for the insert of the same element to finish
+ *	linking its upper levels, if it has not yet: no level may be linked
+ *	after the erase unlinked the node. So erase blocks while that insert's
+ *	thread is stalled, and is not lock-free.
+ *	Elements are const once in: no operator[], no assignment, at() returns
+ *	a copy. size() is exact only when no one writes. The map's own
+ *	epoch_domain frees the retired nodes through the map's allocator, at
+ *	the latest in the destructor, so the allocator may keep state. */
+template <class Key,
+					class T,
+					class Compare = std::less<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class concurrent_skiplist_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef Compare														key_compare;
+
+/** @value_compare: compares the key of objects of type concurrent_skiplist_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class concurrent_skiplist_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::const_reference																		reference;
+		typedef typename Alloc::const_reference																		const_reference;
+		typedef typename Alloc::const_pointer																			pointer;
+		typedef typename Alloc::const_pointer																			const_pointer;
+		typedef ft::skiplist_node<value_type>																			node_type;
+		typedef node_type*																												Node;
+		typedef typename Alloc::template rebind<char>::other											byte_allocator_type;
+		typedef ft::skiplist_iterator<value_type, node_type>											iterator;
+		typedef ft::skiplist_iterator<value_type, node_type>											const_iterator;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+		static const int	max_height = node_type::max_height;
+
+	/** @brief Keeps the nodes this thread reaches in the map alive (see
+	 *	epoch_guard) from construction to destruction */
+		class guard : public ft::epoch_guard {
+			public:
+				explicit guard(const concurrent_skiplist_map& map) : ft::epoch_guard(map._epochs) {}
+		};
+
+	private:
+		Node											_head;
+		volatile long							_levels;		// height of the tallest tower ever linked
+		volatile long							_size;
+		Compare										_comp;
+		allocator_type						_alloc;
+		byte_allocator_type				_bytes;
+		mutable ft::epoch_domain	_epochs;
+
+		concurrent_skiplist_map(const concurrent_skiplist_map&);
+		concurrent_skiplist_map& operator= (const concurrent_skiplist_map&);
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit concurrent_skiplist_map (const key_compare& comp = key_compare(),
+																			const allocator_type& alloc = allocator_type()) :
+		_head(NULL), _levels(1), _size(0), _comp(comp), _alloc(alloc), _bytes(alloc) {
+			_head = reinterpret_cast<Node>(_bytes.allocate(node_type::bytes(max_height)));
+			_head->_height = max_height;
+			_head->_linked = 1;
+			for (int level = 0; level < max_height; ++level)
+				_head->_next[level] = NULL;
+		}
+
+		template <class InputIterator>
+		concurrent_skiplist_map (InputIterator first, InputIterator last,
+														const key_compare& comp = key_compare(),
+														const allocator_type& alloc = allocator_type()) :
+		_head(NULL), _levels(1), _size(0), _comp(comp), _alloc(alloc), _bytes(alloc) {
+			_head = reinterpret_cast<Node>(_bytes.allocate(node_type::bytes(max_height)));
+			_head->_height = max_height;
+			_head->_linked = 1;
+			for (int level = 0; level < max_height; ++level)
+				_head->_next[level] = NULL;
+			insert(first, last);
+		}
+
+/**	DESTRUCTOR: 	no thread may use the map any more */
+		~concurrent_skiplist_map() {
+			Node node = node_type::unmark(_head->_next[0]);
+			while (node) {
+				Node next = node_type::unmark(node->_next[0]);
+				_destroy_node(node);
+				node = next;
+			}
+			_epochs.reclaim_all();
+			_bytes.deallocate(reinterpret_cast<char*>(_head), node_type::bytes(max_height));
+		}
+
+/** ITERATORS:	***/
+		const_iterator begin() const {
+			guard g(*this);
+			return const_iterator(_head->live_next());
+		}
+		const_iterator end() const { return const_iterator(NULL); }
+
+/** CAPACITY:	***/
+		bool empty() const { return begin() == end(); }
+		size_type size() const { return ft::atomic_load(&_size); }
+		size_type max_size() const { return _bytes.max_size() / node_type::bytes(1); }
+
+/** ELEMENT:ACCESS:	***/
+	/** a copy, taken under a guard: the element may be erased and freed
+	 *	as soon as the call returns */
+		mapped_type at (const key_type& k) const {
+			guard g(*this);
+			const_iterator it = find(k);
+			if (it == end()) throw std::out_of_range("concurrent_skiplist_map::at: out of range");
+			return it->second;
+		}
+
+/** MODIFIERS:	***/
+	/** @brief Links a tower of random height: level 0 first, which makes the
+	 *	element visible, then the levels up, searching again whenever a
+	 *	neighbour changed. Stops early if the element is erased meanwhile. */
+		pair<const_iterator, bool> insert (const value_type& val) {
+			guard	g(*this);
+			Node	preds[max_height];
+			Node	succs[max_height];
+			int		height = _random_height();
+			Node	node = NULL;
+
+			while (true) {
+				if (_search(val.first, preds, succs, NULL, height)) {
+					if (node)
+						_destroy_node(node);
+					return ft::make_pair(const_iterator(succs[0]), false);
+				}
+				if (!node)
+					node = _create_node(val, height);
+				for (int level = 0; level < height; ++level)
+					node->_next[level] = succs[level];
+				if (ft::atomic_cas(&preds[0]->_next[0], succs[0], node))
+					break;
+			}
+			ft::atomic_increment(&_size);
+			_raise(height);
+			for (int level = 1; level < height && _link(node, level, preds, succs); ++level)
+				;
+			ft::atomic_store(&node->_linked, 1L);
+			return ft::make_pair(const_iterator(node), true);
+		}
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+	/** @brief Marks level 0 (the erase), then the upper levels top down, then
+	 *	walks to the node on each level to unlink it, and retires it */
+		size_type erase (const key_type& k) {
+			guard	g(*this);
+			Node	preds[max_height];
+			Node	succs[max_height];
+
+			if (!_search(k, preds, succs, NULL, 1))
+				return 0;
+			Node node = succs[0];
+			for (Node succ = node->next(0); ; succ = node->next(0)) {
+				if (node_type::marked(succ))
+					return 0;
+				if (ft::atomic_cas(&node->_next[0], succ, node_type::mark(succ)))
+					break;
+			}
+			ft::atomic_decrement(&_size);
+			while (!ft::atomic_load(&node->_linked))
+				sched_yield();
+			for (int level = node->_height - 1; level > 0; --level) {
+				Node succ = node->next(level);
+				while (!node_type::marked(succ) && !ft::atomic_cas(&node->_next[level], succ, node_type::mark(succ)))
+					succ = node->next(level);
+			}
+			_search(k, preds, succs, node, node->_height);
+			_epochs.retire(node, &_reclaim_node, this);
+			return 1;
+		}
+
+		void erase (const_iterator position) { erase(position->first); }
+
+	/** erases the elements one by one: others may insert meanwhile */
+		void clear() {
+			guard g(*this);
+			for (Node node = _head->live_next(); node; node = node->live_next())
+				erase(node->_data.first);
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return _comp; }
+		value_compare value_comp() const { return value_compare(_comp); }
+
+/** OPERATIONS:	***/
+		const_iterator find (const key_type& k) const {
+			guard g(*this);
+			Node node = _lower_node(k, false);
+			if (node && _comp(k, node->_data.first))
+				node = NULL;
+			return const_iterator(node);
+		}
+
+		size_type count (const key_type& k) const { return find(k) != end(); }
+
+		const_iterator lower_bound (const key_type& k) const {
+			guard g(*this);
+			return const_iterator(_lower_node(k, false));
+		}
+
+		const_iterator upper_bound (const key_type& k) const {
+			guard g(*this);
+			return const_iterator(_lower_node(k, true));
+		}
+
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+		Node _create_node(const value_type& val, int height) {
+			Node node = reinterpret_cast<Node>(_bytes.allocate(node_type::bytes(height)));
+			try {
+				new (static_cast<void*>(&node->_data)) value_type(val);
+			}
+			catch (...) {
+				_bytes.deallocate(reinterpret_cast<char*>(node), node_type::bytes(height));
+				throw;
+			}
+			node->_height = height;
+			node->_linked = 0;
+			return node;
+		}
+
+		void _destroy_node(Node node) {
+			int height = node->_height;
+			node->_data.~value_type();
+			_bytes.deallocate(reinterpret_cast<char*>(node), node_type::bytes(height));
+		}
+
+	/** how the epoch domain frees an erased node */
+		static void _reclaim_node(void* map, void* node) {
+			static_cast<concurrent_skiplist_map*>(map)->_destroy_node(static_cast<Node>(node));
+		}
+
+	/** 1 + the number of times two random bits are both 0: P(h) = 4^-(h-1) */
+		static int _random_height() {
+#if defined(__GNUC__)
+			static __thread unsigned	state = 0;
+			if (state == 0)
+				state = static_cast<unsigned>(ft::hash_mix(reinterpret_cast<std::size_t>(&state))) | 1;
+#else
+			static volatile long	counter = 0;
+			unsigned	state = static_cast<unsigned>(ft::hash_mix(ft::atomic_increment(&counter))) | 1;
+#endif
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			unsigned	bits = state;
+			int				height = 1;
+			while ((bits & 3) == 0 && height < max_height) {
+				++height;
+				bits >>= 2;
+			}
+			return height;
+		}
+
+		void _raise(int height) {
+			long levels = ft::atomic_load(&_levels);
+			while (height > levels && !ft::atomic_cas(&_levels, levels, static_cast<long>(height)))
+				levels = ft::atomic_load(&_levels);
+		}
+
+	/** @brief Fills preds/succs with the neighbours of 'k' on every level up to
+	 *	at least 'height', unlinking the marked nodes met on the way; starts
+	 *	over when an unlink loses a race. With a 'target', also walks past the
+	 *	nodes of equal key up to that one, so that it is met (and, once
+	 *	marked, unlinked) on every level it is on.
+	 *	@return whether succs[0] is an element of key 'k' */
+		bool _search(const key_type& k, Node* preds, Node* succs, Node target, int height) const {
+			int top = ft::atomic_load(&_levels);
+			if (top < height)
+				top = height;
+		retry:
+			Node pred = _head;
+			for (int level = top - 1; level >= 0; --level) {
+				Node curr = node_type::unmark(pred->next(level));
+				while (curr) {
+					Node succ = curr->next(level);
+					if (node_type::marked(succ)) {
+						if (!ft::atomic_cas(&pred->_next[level], curr, node_type::unmark(succ)))
+							goto retry;
+						curr = node_type::unmark(succ);
+						continue;
+					}
+					if (!_comp(curr->_data.first, k) && (!target || curr == target || _comp(k, curr->_data.first)))
+						break;
+					pred = curr;
+					curr = succ;
+				}
+				preds[level] = pred;
+				succs[level] = curr;
+			}
+			return succs[0] && !_comp(k, succs[0]->_data.first);
+		}
+
+	/** @brief Links 'node' on 'level' between preds/succs[level], searching
+	 *	again until that holds. @return false if the node was erased
+	 *	meanwhile: the levels above are then left out. */
+		bool _link(Node node, int level, Node* preds, Node* succs) {
+			while (true) {
+				Node succ = node->next(level);
+				if (node_type::marked(succ))
+					return false;
+				if (succ != succs[level] && !ft::atomic_cas(&node->_next[level], succ, succs[level]))
+					return false;
+				if (ft::atomic_cas(&preds[level]->_next[level], succs[level], node))
+					return true;
+				_search(node->_data.first, preds, succs, node, node->_height);
+				if (node_type::marked(node->next(0)))
+					return false;
+			}
+		}
+
+	/** first element whose key is not less than 'k' ('after': greater than
+	 *	'k'), stepping over erased ones; reads only */
+		Node _lower_node(const key_type& k, bool after) const {
+			Node pred = _head;
+			Node curr = NULL;
+			for (int level = ft::atomic_load(&_levels) - 1; level >= 0; --level) {
+				curr = node_type::unmark(pred->next(level));
+				while (curr) {
+					Node succ = curr->next(level);
+					if (node_type::marked(succ)) {
+						curr = node_type::unmark(succ);
+						continue;
+					}
+					if (after ? _comp(k, curr->_data.first) : !_comp(curr->_data.first, k))
+						break;
+					pred = curr;
+					curr = succ;
+				}
+			}
+			return curr;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,401 @@
+#ifndef _FLAT_MAP_HPP_
+#define _FLAT_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "vector.hpp"
+#include "../inc/pair.hpp"
+#include "../inc/flat_iterator.hpp"
+#include "../inc/reverse_iterator.hpp"
+#include "../inc/index_sort.hpp"
+
+namespace ft {
+
+	/*--------------*/
+ /**	FLAT:MAP:  */
+/*--------------*/
+
+/**	@brief Map interface over two sorted ft::vectors, one of keys and one of
+ *	mapped values, for tables that are built once and then mostly read.
+ *	A lookup is a binary search through the packed keys only, and iteration
+ *	walks two arrays: no node, no pointer to chase, nothing between elements.
+ *	The price is on writes: a single insert or erase shifts every element
+ *	after it, and both invalidate iterators (as for ft::vector).
+ *	Batches should go through insert(first, last), which sorts the new
+ *	elements and merges them with the table in one linear pass.
+ *	Dereferencing an iterator gives a ft::flat_reference (first, second)
+ *	rather than a value_type&. */
+template <class Key,
+					class T,
+					class Compare = std::less<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class flat_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef Compare														key_compare;
+
+/** @value_compare: compares the key of objects of type flat_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class flat_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::template rebind<Key>::other												key_allocator_type;
+		typedef typename Alloc::template rebind<T>::other													mapped_allocator_type;
+		typedef ft::vector<Key, key_allocator_type>																key_container_type;
+		typedef ft::vector<T, mapped_allocator_type>															mapped_container_type;
+		typedef ft::flat_iterator<Key, T>																					iterator;
+		typedef ft::flat_iterator<Key, const T>																		const_iterator;
+		typedef typename iterator::reference																			reference;
+		typedef typename const_iterator::reference																const_reference;
+		typedef typename iterator::pointer																				pointer;
+		typedef typename const_iterator::pointer																	const_pointer;
+		typedef ft::reverse_iterator<iterator>																		reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>															const_reverse_iterator;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+		key_container_type			_keys;			// sorted, no duplicates
+		mapped_container_type		_values;		// _values[i] belongs to _keys[i]
+		Compare									_comp;
+		allocator_type					_alloc;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit flat_map (const key_compare& comp = key_compare(),
+											const allocator_type& alloc = allocator_type()) :
+		_keys(key_allocator_type(alloc)), _values(mapped_allocator_type(alloc)), _comp(comp), _alloc(alloc) {}
+
+		template <class InputIterator>
+		flat_map (InputIterator first, InputIterator last,
+							const key_compare& comp = key_compare(),
+							const allocator_type& alloc = allocator_type()) :
+		_keys(key_allocator_type(alloc)), _values(mapped_allocator_type(alloc)), _comp(comp), _alloc(alloc) {
+			insert(first, last);
+		}
+
+		flat_map (const flat_map& x) :
+		_keys(x._keys), _values(x._values), _comp(x._comp), _alloc(x._alloc) {}
+
+/**	DESTRUCTOR: 	*/
+		~flat_map() {}
+
+		flat_map& operator= (const flat_map& x) {
+			if (this == &x) return *this;
+			_keys = x._keys;
+			_values = x._values;
+			_comp = x._comp;
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		iterator begin() { return iterator(_keys.data(), _values.data()); }
+		const_iterator begin() const { return const_iterator(_keys.data(), _values.data()); }
+		iterator end() { return begin() + size(); }
+		const_iterator end() const { return begin() + size(); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _keys.empty(); }
+		size_type size() const { return _keys.size(); }
+		size_type max_size() const {
+			return _keys.max_size() < _values.max_size() ? _keys.max_size() : _values.max_size();
+		}
+
+	/** room for 'n' elements in both arrays: no reallocation below that */
+		void reserve(size_type n) {
+			if (n > _keys.capacity())
+				_keys.reserve(n);
+			if (n > _values.capacity())
+				_values.reserve(n);
+		}
+
+		size_type capacity() const {
+			return _keys.capacity() < _values.capacity() ? _keys.capacity() : _values.capacity();
+		}
+
+	/** gives back the room past size(): both arrays are copied into exact fits */
+		void shrink_to_fit() {
+			if (_keys.capacity() != size())
+				key_container_type(_keys.begin(), _keys.end(), _keys.get_allocator()).swap(_keys);
+			if (_values.capacity() != size())
+				mapped_container_type(_values.begin(), _values.end(), _values.get_allocator()).swap(_values);
+		}
+
+/** ELEMENT:ACCESS:	***/
+		mapped_type& operator[] (const key_type& k) {
+			return insert(ft::make_pair(k, mapped_type())).first->second;
+		}
+
+		mapped_type& at (const key_type& k) {
+			iterator it = find(k);
+			if (it == end()) throw std::out_of_range("flat_map::at: out of range");
+			return it->second;
+		}
+
+		const mapped_type& at (const key_type& k) const {
+			const_iterator it = find(k);
+			if (it == end()) throw std::out_of_range("flat_map::at: out of range");
+			return it->second;
+		}
+
+	/** the sorted arrays themselves, read only */
+		const key_container_type& keys() const { return _keys; }
+		const mapped_container_type& values() const { return _values; }
+
+/** MODIFIERS:	***/
+		pair<iterator, bool> insert (const value_type& val) {
+			size_type i = _lower(val.first);
+			if (i != size() && !_comp(val.first, _keys[i]))
+				return ft::make_pair(begin() + i, false);
+			_insert(i, val);
+			return ft::make_pair(begin() + i, true);
+		}
+
+	/** a hint just past the new key (end() when appending in order) skips the search */
+		iterator insert (iterator position, const value_type& val) {
+			size_type i = position - begin();
+			if ((i == size() || _comp(val.first, _keys[i])) && (i == 0 || _comp(_keys[i - 1], val.first))) {
+				_insert(i, val);
+				return begin() + i;
+			}
+			return insert(val).first;
+		}
+
+	/** @brief Adds a batch in O(size() + n log n) rather than n shifting inserts:
+	 *	the batch is copied, stable-sorted, and merged with the table into new
+	 *	arrays in one pass. As with single inserts, a key already in the table
+	 *	keeps its value and the first of equal keys in the batch wins. */
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			key_container_type		batch_keys(_keys.get_allocator());
+			mapped_container_type	batch_values(_values.get_allocator());
+			for (; first != last; ++first) {
+				batch_keys.push_back((*first).first);
+				batch_values.push_back((*first).second);
+			}
+			if (batch_keys.empty())
+				return;
+
+			ft::vector<size_type>	order;
+			ft::index_sort(batch_keys, batch_keys.size(), order, _comp);
+
+			key_container_type		keys(_keys.get_allocator());
+			mapped_container_type	values(_values.get_allocator());
+			keys.reserve(size() + order.size());
+			values.reserve(size() + order.size());
+
+			size_type i = 0;
+			size_type j = 0;
+			while (j < order.size()) {
+				const Key& k = batch_keys[order[j]];
+				if (j > 0 && !_comp(batch_keys[order[j - 1]], k)) {		// equal to the one before
+					++j;
+					continue;
+				}
+				if (i < size() && !_comp(k, _keys[i])) {
+					if (!_comp(_keys[i], k))		// already in the table
+						++j;
+					keys.push_back(_keys[i]);
+					values.push_back(_values[i++]);
+				}
+				else {
+					keys.push_back(k);
+					values.push_back(batch_values[order[j++]]);
+				}
+			}
+			for (; i < size(); ++i) {
+				keys.push_back(_keys[i]);
+				values.push_back(_values[i]);
+			}
+			_keys.swap(keys);
+			_values.swap(values);
+		}
+
+		void erase (iterator position) {
+			size_type i = position - begin();
+			_keys.erase(_keys.begin() + i);
+			_values.erase(_values.begin() + i);
+		}
+
+		size_type erase (const key_type& k) {
+			iterator it = find(k);
+			if (it == end()) return 0;
+			erase(it);
+			return 1;
+		}
+
+		void erase (iterator first, iterator last) {
+			size_type i = first - begin();
+			size_type j = last - begin();
+			_keys.erase(_keys.begin() + i, _keys.begin() + j);
+			_values.erase(_values.begin() + i, _values.begin() + j);
+		}
+
+		void swap (flat_map& x) {
+			_keys.swap(x._keys);
+			_values.swap(x._values);
+
+			Compare comp = _comp;
+			_comp = x._comp;
+			x._comp = comp;
+
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+		}
+
+	/** keeps the capacity for the next elements */
+		void clear() {
+			_keys.clear();
+			_values.clear();
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return _comp; }
+		value_compare value_comp() const { return value_compare(_comp); }
+
+/** OPERATIONS:	***/
+		iterator find (const key_type& k) { return begin() + _find(k); }
+		const_iterator find (const key_type& k) const { return begin() + _find(k); }
+
+		size_type count (const key_type& k) const { return _find(k) != size(); }
+
+		iterator lower_bound (const key_type& k) { return begin() + _lower(k); }
+		const_iterator lower_bound (const key_type& k) const { return begin() + _lower(k); }
+		iterator upper_bound (const key_type& k) { return begin() + _upper(k); }
+		const_iterator upper_bound (const key_type& k) const { return begin() + _upper(k); }
+
+		pair<iterator, iterator> equal_range (const key_type& k) {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+	/** first index whose key is not less than k, size() if none */
+		size_type _lower(const key_type& k) const {
+			const Key* keys = _keys.data();
+			size_type lo = 0;
+			size_type n = size();
+			while (lo < n) {
+				size_type mid = lo + (n - lo) / 2;
+				if (_comp(keys[mid], k))
+					lo = mid + 1;
+				else
+					n = mid;
+			}
+			return lo;
+		}
+
+	/** first index whose key is greater than k, size() if none */
+		size_type _upper(const key_type& k) const {
+			const Key* keys = _keys.data();
+			size_type lo = 0;
+			size_type n = size();
+			while (lo < n) {
+				size_type mid = lo + (n - lo) / 2;
+				if (_comp(k, keys[mid]))
+					n = mid;
+				else
+					lo = mid + 1;
+			}
+			return lo;
+		}
+
+	/** index of k, size() (end) if k is not in the map */
+		size_type _find(const key_type& k) const {
+			size_type i = _lower(k);
+			if (i != size() && _comp(k, _keys[i]))
+				return size();
+			return i;
+		}
+
+	/** puts 'val' at index i; the key goes back out if the value cannot follow */
+		void _insert(size_type i, const value_type& val) {
+			_keys.insert(_keys.begin() + i, val.first);
+			try {
+				_values.insert(_values.begin() + i, val.second);
+			}
+			catch (...) {
+				_keys.erase(_keys.begin() + i);
+				throw;
+			}
+		}
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator == (const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs) {
+		return lhs.keys() == rhs.keys() && lhs.values() == rhs.values(); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator != (const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+/** elements compare as pairs: by key, then by mapped value */
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator < (const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs) {
+		std::size_t n = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+		for (std::size_t i = 0; i < n; ++i) {
+			if (lhs.keys()[i] < rhs.keys()[i])
+				return true;
+			if (rhs.keys()[i] < lhs.keys()[i])
+				return false;
+			if (lhs.values()[i] < rhs.values()[i])
+				return true;
+			if (rhs.values()[i] < lhs.values()[i])
+				return false;
+		}
+		return lhs.size() < rhs.size();
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator <= (const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs) {
+		return !(rhs < lhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator > (const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs) {
+		return rhs < lhs; }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator >= (const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs < rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (flat_map<Key, T, Compare, Alloc>& lhs, flat_map<Key, T, Compare, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
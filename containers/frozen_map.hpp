@@ -0,0 +1,354 @@
+#ifndef _FROZEN_MAP_HPP_
+#define _FROZEN_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "vector.hpp"
+#include "flat_map.hpp"
+#include "../inc/pair.hpp"
+#include "../inc/compare.hpp"
+#include "../inc/prefetch.hpp"
+#include "../inc/eytzinger_iterator.hpp"
+#include "../inc/reverse_iterator.hpp"
+
+namespace ft {
+
+/**	@brief Tag saying a range is already sorted by the comparator with no
+ *	equal keys (as std::sorted_unique for C++23's flat_map): the container
+ *	takes it as it comes instead of sorting it again */
+	struct sorted_unique_t {};
+	static const sorted_unique_t	sorted_unique = sorted_unique_t();
+
+	/*----------------*/
+ /**	FROZEN:MAP:  */
+/*----------------*/
+
+/**	@brief Read-only map for tables built once and then only looked up.
+ *	The keys sit in one array in Eytzinger (breadth-first) order: the root,
+ *	then its two children, then the four below... so a search walks a
+ *	complete binary tree whose first levels share a few cache lines and
+ *	whose next nodes are computed, not loaded. Each level is a single
+ *	comparison folded into the index (no branch to mispredict), and the
+ *	line four levels down is prefetched while the current one is compared.
+ *	The mapped values are in a second array in the same order, touched only
+ *	once the key is found. Iteration is in key order (eytzinger_iterator).
+ *	Built from ft::map::freeze(), any range of pairs, or a sorted_unique
+ *	range; there is no insert or erase, and the mapped values are const. */
+template <class Key,
+					class T,
+					class Compare = std::less<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class frozen_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef Compare														key_compare;
+
+/** @value_compare: compares the key of objects of type frozen_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class frozen_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::template rebind<Key>::other												key_allocator_type;
+		typedef typename Alloc::template rebind<T>::other													mapped_allocator_type;
+		typedef ft::vector<Key, key_allocator_type>																key_container_type;
+		typedef ft::vector<T, mapped_allocator_type>															mapped_container_type;
+		typedef ft::eytzinger_iterator<Key, const T>															iterator;
+		typedef ft::eytzinger_iterator<Key, const T>															const_iterator;
+		typedef typename const_iterator::reference																reference;
+		typedef typename const_iterator::reference																const_reference;
+		typedef typename const_iterator::pointer																	pointer;
+		typedef typename const_iterator::pointer																	const_pointer;
+		typedef ft::reverse_iterator<const_iterator>															reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>															const_reverse_iterator;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+	/** keys per cache line, rounded down to a power of two (at least 2):
+	 *	the descendants 'log2(prefetch_stride)' levels below position k start
+	 *	at k * prefetch_stride and fill about one line */
+		static const size_type	prefetch_stride = sizeof(Key) <= 4 ? 16 : sizeof(Key) <= 8 ? 8
+																		: sizeof(Key) <= 16 ? 4 : 2;
+
+		key_container_type			_keys;			// Eytzinger order: position k at index k - 1
+		mapped_container_type		_values;		// _values[i] belongs to _keys[i]
+		Compare									_comp;
+		allocator_type					_alloc;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit frozen_map (const key_compare& comp = key_compare(),
+												const allocator_type& alloc = allocator_type()) :
+		_keys(key_allocator_type(alloc)), _values(mapped_allocator_type(alloc)), _comp(comp), _alloc(alloc) {}
+
+	/** any range: sorted through a flat_map first, the first of equal keys wins */
+		template <class InputIterator>
+		frozen_map (InputIterator first, InputIterator last,
+								const key_compare& comp = key_compare(),
+								const allocator_type& alloc = allocator_type()) :
+		_keys(key_allocator_type(alloc)), _values(mapped_allocator_type(alloc)), _comp(comp), _alloc(alloc) {
+			ft::flat_map<Key, T, Compare, Alloc>	sorted(first, last, comp, alloc);
+			_layout(sorted.keys().data(), sorted.values().data(), sorted.size());
+		}
+
+	/** a range already in key order without duplicates, laid out in O(n) */
+		template <class InputIterator>
+		frozen_map (sorted_unique_t, InputIterator first, InputIterator last,
+								const key_compare& comp = key_compare(),
+								const allocator_type& alloc = allocator_type()) :
+		_keys(key_allocator_type(alloc)), _values(mapped_allocator_type(alloc)), _comp(comp), _alloc(alloc) {
+			key_container_type		keys(_keys.get_allocator());
+			mapped_container_type	values(_values.get_allocator());
+			for (; first != last; ++first) {
+				keys.push_back((*first).first);
+				values.push_back((*first).second);
+			}
+			_layout(keys.data(), values.data(), keys.size());
+		}
+
+		frozen_map (const frozen_map& x) :
+		_keys(x._keys), _values(x._values), _comp(x._comp), _alloc(x._alloc) {}
+
+/**	DESTRUCTOR: 	*/
+		~frozen_map() {}
+
+		frozen_map& operator= (const frozen_map& x) {
+			if (this == &x) return *this;
+			_keys = x._keys;
+			_values = x._values;
+			_comp = x._comp;
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		const_iterator begin() const {
+			if (empty())
+				return end();
+			size_type pos = 1;
+			while (2 * pos <= size())
+				pos = 2 * pos;
+			return _at(pos);
+		}
+		const_iterator end() const { return _at(0); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _keys.empty(); }
+		size_type size() const { return _keys.size(); }
+		size_type max_size() const {
+			return _keys.max_size() < _values.max_size() ? _keys.max_size() : _values.max_size();
+		}
+
+/** ELEMENT:ACCESS:	***/
+		const mapped_type& at (const key_type& k) const {
+			size_type pos = _find(k);
+			if (pos == 0) throw std::out_of_range("frozen_map::at: out of range");
+			return _values[pos - 1];
+		}
+
+	/** the arrays themselves, in layout order, read only */
+		const key_container_type& keys() const { return _keys; }
+		const mapped_container_type& values() const { return _values; }
+
+/** MODIFIERS:	***/
+		void swap (frozen_map& x) {
+			_keys.swap(x._keys);
+			_values.swap(x._values);
+
+			Compare comp = _comp;
+			_comp = x._comp;
+			x._comp = comp;
+
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+		}
+
+		void clear() {
+			_keys.clear();
+			_values.clear();
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return _comp; }
+		value_compare value_comp() const { return value_compare(_comp); }
+
+/** OPERATIONS:	***/
+		const_iterator find (const key_type& k) const { return _at(_find(k)); }
+		size_type count (const key_type& k) const { return _find(k) != 0; }
+		const_iterator lower_bound (const key_type& k) const { return _at(_lower(k)); }
+		const_iterator upper_bound (const key_type& k) const { return _at(_upper(k)); }
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+	/** the same lookups for any type a transparent Compare takes (see compare.hpp) */
+		template <class K>
+		typename ft::enable_transparent<Compare, K, const_iterator>::type find(const K& k) const {
+			return _at(_find(k));
+		}
+
+		template <class K>
+		typename ft::enable_transparent<Compare, K, size_type>::type count(const K& k) const {
+			return _find(k) != 0;
+		}
+
+		template <class K>
+		typename ft::enable_transparent<Compare, K, const_iterator>::type lower_bound(const K& k) const {
+			return _at(_lower(k));
+		}
+
+		template <class K>
+		typename ft::enable_transparent<Compare, K, const_iterator>::type upper_bound(const K& k) const {
+			return _at(_upper(k));
+		}
+
+		template <class K>
+		typename ft::enable_transparent<Compare, K, pair<const_iterator, const_iterator> >::type
+		equal_range(const K& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+		const_iterator _at(size_type pos) const {
+			return const_iterator(_keys.data(), _values.data(), size(), pos);
+		}
+
+	/** @brief Position of the first key not less than k, 0 if none.
+	 *	Each step appends the comparison as the next bit of the position
+	 *	(0: left, 1: right), so the loop runs exactly the tree's height. The
+	 *	answer is the last node we went left at: strip the trailing right
+	 *	turns and that left turn off the final position. */
+		template <class K>
+		size_type _lower(const K& k) const {
+			const Key*	keys = _keys.data();
+			size_type		n = size();
+			size_type		pos = 1;
+			while (pos <= n) {
+				size_type ahead = pos * prefetch_stride;
+				FT_PREFETCH(keys + (ahead <= n ? ahead - 1 : 0));
+				pos = 2 * pos + _comp(keys[pos - 1], k);
+			}
+			return eytzinger_after(pos);
+		}
+
+	/** same walk going right on keys not greater than k */
+		template <class K>
+		size_type _upper(const K& k) const {
+			const Key*	keys = _keys.data();
+			size_type		n = size();
+			size_type		pos = 1;
+			while (pos <= n) {
+				size_type ahead = pos * prefetch_stride;
+				FT_PREFETCH(keys + (ahead <= n ? ahead - 1 : 0));
+				pos = 2 * pos + !_comp(k, keys[pos - 1]);
+			}
+			return eytzinger_after(pos);
+		}
+
+	/** position of k, 0 (end) if k is not in the map */
+		template <class K>
+		size_type _find(const K& k) const {
+			size_type pos = _lower(k);
+			if (pos != 0 && _comp(k, _keys[pos - 1]))
+				return 0;
+			return pos;
+		}
+
+	/** copies the 'n' sorted elements into Eytzinger order */
+		void _layout(const Key* keys, const T* values, size_type n) {
+			ft::vector<size_type>	rank(n);
+			size_type							next = 0;
+			_rank(rank, 1, next);
+			_keys.reserve(n);
+			_values.reserve(n);
+			for (size_type i = 0; i < n; ++i) {
+				_keys.push_back(keys[rank[i]]);
+				_values.push_back(values[rank[i]]);
+			}
+		}
+
+	/** in-order walk of the implicit tree: rank[pos - 1] is the sorted index at pos */
+		static void _rank(ft::vector<size_type>& rank, size_type pos, size_type& next) {
+			if (pos > rank.size())
+				return;
+			_rank(rank, 2 * pos, next);
+			rank[pos - 1] = next++;
+			_rank(rank, 2 * pos + 1, next);
+		}
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+/** maps of the same size share the layout: equal maps have equal arrays */
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator == (const frozen_map<Key, T, Compare, Alloc>& lhs, const frozen_map<Key, T, Compare, Alloc>& rhs) {
+		return lhs.keys() == rhs.keys() && lhs.values() == rhs.values(); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator != (const frozen_map<Key, T, Compare, Alloc>& lhs, const frozen_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+/** elements compare as pairs, in key order: by key, then by mapped value */
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator < (const frozen_map<Key, T, Compare, Alloc>& lhs, const frozen_map<Key, T, Compare, Alloc>& rhs) {
+		typename frozen_map<Key, T, Compare, Alloc>::const_iterator	a = lhs.begin();
+		typename frozen_map<Key, T, Compare, Alloc>::const_iterator	b = rhs.begin();
+		for (; a != lhs.end() && b != rhs.end(); ++a, ++b) {
+			if (a->first < b->first)
+				return true;
+			if (b->first < a->first)
+				return false;
+			if (a->second < b->second)
+				return true;
+			if (b->second < a->second)
+				return false;
+		}
+		return a == lhs.end() && b != rhs.end();
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator <= (const frozen_map<Key, T, Compare, Alloc>& lhs, const frozen_map<Key, T, Compare, Alloc>& rhs) {
+		return !(rhs < lhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator > (const frozen_map<Key, T, Compare, Alloc>& lhs, const frozen_map<Key, T, Compare, Alloc>& rhs) {
+		return rhs < lhs; }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator >= (const frozen_map<Key, T, Compare, Alloc>& lhs, const frozen_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs < rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (frozen_map<Key, T, Compare, Alloc>& lhs, frozen_map<Key, T, Compare, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,405 @@
+#ifndef _LSM_MAP_HPP_
+#define _LSM_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "vector.hpp"
+#include "../inc/pair.hpp"
+#include "../inc/lex_compare.hpp"
+#include "../inc/lsm_entry.hpp"
+#include "../inc/lsm_iterator.hpp"
+
+namespace ft {
+
+	/*-------------*/
+ /**	LSM:MAP:  */
+/*-------------*/
+
+/**	@brief Ordered map for bursts of writes (log-structured merge): a write
+ *	goes to a small sorted buffer, one record per key, with a binary search
+ *	and a shift of at most buffer_limit() records: no allocation (past the
+ *	buffer's) and no rebalancing. A full buffer becomes an immutable run,
+ *	as it is; runs are then merged,
+ *	two at a time, as long as the older one is less than 'fanout' times the
+ *	size of the newer, so their sizes grow geometrically and there are
+ *	O(log n) of them. Merges are sequential passes over arrays, and each
+ *	record takes part in O(log n) of them.
+ *	Writes are blind: insert_or_assign() and erase() (which writes a
+ *	tombstone) never look at what is there, so they cannot say what they
+ *	did; insert() looks first. A lookup searches the buffer, then the runs
+ *	from the newest until one holds the key. Iteration merges the buffer
+ *	and the runs on the fly (lsm_iterator). Buffer and runs only change on
+ *	writes: const member functions only read, so concurrent ones are safe
+ *	as with the standard containers, and any write invalidates iterators.
+ *	size() walks the whole map, since a
+ *	key may have records in several runs. compact() merges everything into
+ *	a single run, which makes lookups as cheap as in a sorted array. */
+template <class Key,
+					class T,
+					class Compare = std::less<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class lsm_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef Compare														key_compare;
+
+/** @value_compare: compares the key of objects of type lsm_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class lsm_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+		static const size_type	default_buffer = 256;
+		static const size_type	fanout = 4;
+		static const size_type	max_runs = 64;
+
+		typedef Alloc																															allocator_type;
+		typedef ft::lsm_entry<Key, T>																							entry_type;
+		typedef typename Alloc::template rebind<entry_type>::other								entry_allocator_type;
+		typedef ft::vector<entry_type, entry_allocator_type>											run_type;
+		typedef ft::lsm_iterator<entry_type, Compare, max_runs + 1>								iterator;		// the runs and the buffer
+		typedef ft::lsm_iterator<entry_type, Compare, max_runs + 1>								const_iterator;
+		typedef typename iterator::reference																			reference;
+		typedef typename iterator::reference																			const_reference;
+
+	private:
+		run_type							_buffer;		// sorted, one record per key, newer than the runs
+		ft::vector<run_type>	_runs;			// sorted, one record per key, oldest first
+		size_type										_limit;
+		Compare											_comp;
+		allocator_type							_alloc;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit lsm_map (const key_compare& comp = key_compare(),
+											const allocator_type& alloc = allocator_type()) :
+		_buffer(entry_allocator_type(alloc)), _limit(default_buffer), _comp(comp), _alloc(alloc) {
+			_buffer.reserve(_limit);
+			_runs.reserve(max_runs);
+		}
+
+		template <class InputIterator>
+		lsm_map (InputIterator first, InputIterator last,
+						const key_compare& comp = key_compare(),
+						const allocator_type& alloc = allocator_type()) :
+		_buffer(entry_allocator_type(alloc)), _limit(default_buffer), _comp(comp), _alloc(alloc) {
+			_buffer.reserve(_limit);
+			_runs.reserve(max_runs);
+			insert(first, last);
+		}
+
+		lsm_map (const lsm_map& x) :
+		_buffer(x._buffer), _runs(x._runs), _limit(x._limit), _comp(x._comp), _alloc(x._alloc) {
+			_buffer.reserve(_limit);
+			_runs.reserve(max_runs);
+		}
+
+/**	DESTRUCTOR: 	*/
+		~lsm_map() {}
+
+/**	ASSIGN:OPERATOR: 	*/
+		lsm_map& operator= (const lsm_map& x) {
+			if (this != &x) {
+				lsm_map tmp(x);
+				swap(tmp);
+			}
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		const_iterator begin() const {
+			const_iterator it(_comp);
+			for (size_type i = 0; i < _runs.size(); ++i)
+				it.push(_runs[i].data(), _runs[i].data() + _runs[i].size());
+			it.push(_buffer.data(), _buffer.data() + _buffer.size());
+			it.select();
+			return it;
+		}
+
+		const_iterator end() const { return const_iterator(_comp); }
+
+/** CAPACITY:	***/
+		bool empty() const { return begin() == end(); }
+
+	/** O(n): walks the map */
+		size_type size() const {
+			size_type n = 0;
+			for (const_iterator it = begin(); it != end(); ++it)
+				++n;
+			return n;
+		}
+
+		size_type max_size() const { return _buffer.max_size(); }
+
+	/** records written to the buffer before it is sealed into a run */
+		size_type buffer_limit() const { return _limit; }
+
+		void buffer_limit(size_type n) {
+			_limit = n ? n : 1;
+			if (_buffer.size() >= _limit)
+				_seal();
+			_buffer.reserve(_limit);
+		}
+
+	/** sorted runs, the buffer not counted */
+		size_type run_count() const { return _runs.size(); }
+
+/** ELEMENT:ACCESS:	***/
+		const mapped_type& at (const key_type& k) const {
+			const entry_type* e = _lookup(k);
+			if (!e) throw std::out_of_range("lsm_map::at: out of range");
+			return e->_data.second;
+		}
+
+/** MODIFIERS:	***/
+	/** writes 'obj' under 'k', whatever was there */
+		void insert_or_assign (const key_type& k, const mapped_type& obj) { _write(entry_type(k, obj, false)); }
+
+	/** writes 'val' if its key is not there, which takes a lookup
+	 *	@return whether it did */
+		bool insert (const value_type& val) {
+			if (_lookup(val.first))
+				return false;
+			_write(entry_type(val.first, val.second, false));
+			return true;
+		}
+
+	/** blind writes, the last of equal keys winning */
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				insert_or_assign((*first).first, (*first).second);
+		}
+
+	/** writes a tombstone for 'k', whether or not it is there */
+		void erase (const key_type& k) { _write(entry_type(k, mapped_type(), true)); }
+
+		void swap (lsm_map& x) {
+			_buffer.swap(x._buffer);
+			_runs.swap(x._runs);
+
+			size_type limit = _limit;
+			_limit = x._limit;
+			x._limit = limit;
+
+			Compare comp = _comp;
+			_comp = x._comp;
+			x._comp = comp;
+
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+		}
+
+		void clear() {
+			_buffer.clear();
+			_runs.clear();
+		}
+
+	/** seals the buffer and merges every run into one, tombstones dropped */
+		void compact() {
+			_seal();
+			if (_runs.empty())
+				return;
+			if (_runs.size() == 1)		// merged with nothing, for its tombstones to go
+				_runs.push_back(run_type(_runs[0].get_allocator()));
+			while (_runs.size() > 1)
+				_merge_last();
+			if (_runs[0].empty())
+				_runs.pop_back();
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return _comp; }
+		value_compare value_comp() const { return value_compare(_comp); }
+
+/** OPERATIONS:	***/
+		const_iterator find (const key_type& k) const {
+			if (!_lookup(k))
+				return end();
+			return lower_bound(k);
+		}
+
+		size_type count (const key_type& k) const { return _lookup(k) != NULL; }
+
+	/** copies the value of 'k' into 'out' if it is there */
+		bool get (const key_type& k, mapped_type& out) const {
+			const entry_type* e = _lookup(k);
+			if (e)
+				out = e->_data.second;
+			return e != NULL;
+		}
+
+		const_iterator lower_bound (const key_type& k) const {
+			const_iterator it(_comp);
+			for (size_type i = 0; i < _runs.size(); ++i)
+				it.push(_bound(_runs[i], k, false), _runs[i].data() + _runs[i].size());
+			it.push(_bound(_buffer, k, false), _buffer.data() + _buffer.size());
+			it.select();
+			return it;
+		}
+
+		const_iterator upper_bound (const key_type& k) const {
+			const_iterator it(_comp);
+			for (size_type i = 0; i < _runs.size(); ++i)
+				it.push(_bound(_runs[i], k, true), _runs[i].data() + _runs[i].size());
+			it.push(_bound(_buffer, k, true), _buffer.data() + _buffer.size());
+			it.select();
+			return it;
+		}
+
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+	/** replaces the buffer's record of the key, or inserts one in order */
+		void _write(const entry_type& e) {
+			size_type i = _bound(_buffer, e._data.first, false) - _buffer.data();
+			if (i < _buffer.size() && !_comp(e._data.first, _buffer[i]._data.first)) {
+				_buffer[i] = e;
+				return;
+			}
+			_buffer.insert(_buffer.begin() + i, e);
+			if (_buffer.size() >= _limit)
+				_seal();
+		}
+
+	/** the newest record of 'k' if it is a value, else NULL */
+		const entry_type* _lookup(const key_type& k) const {
+			const entry_type* e = _bound(_buffer, k, false);
+			if (e != _buffer.data() + _buffer.size() && !_comp(k, e->_data.first))
+				return e->_erased ? NULL : e;
+			for (size_type i = _runs.size(); i-- > 0; ) {
+				const entry_type* e = _bound(_runs[i], k, false);
+				if (e != _runs[i].data() + _runs[i].size() && !_comp(k, e->_data.first))
+					return e->_erased ? NULL : e;
+			}
+			return NULL;
+		}
+
+	/** first record of 'run' whose key is not less than 'k' ('after':
+	 *	greater than 'k') */
+		const entry_type* _bound(const run_type& run, const key_type& k, bool after) const {
+			const entry_type* first = run.data();
+			size_type n = run.size();
+			while (n > 0) {
+				size_type half = n / 2;
+				const key_type& key = first[half]._data.first;
+				if (after ? !_comp(k, key) : _comp(key, k)) {
+					first += half + 1;
+					n -= half + 1;
+				}
+				else
+					n = half;
+			}
+			return first;
+		}
+
+	/** @brief Turns the buffer, already sorted, into the newest run, then
+	 *	merges runs while the older of the last two is not 'fanout' times the
+	 *	size of the newer */
+		void _seal() {
+			if (_buffer.empty())
+				return;
+			_runs.push_back(run_type(_buffer.get_allocator()));
+			_runs.back().swap(_buffer);
+			_buffer.reserve(_limit);
+			while (_runs.size() > 1 && (_runs.size() >= max_runs
+							|| _runs[_runs.size() - 2].size() < fanout * _runs.back().size()))
+				_merge_last();
+		}
+
+	/** merges the last two runs into one, the newer winning on equal keys;
+	 *	tombstones go once nothing older is left for them to hide */
+		void _merge_last() {
+			size_type	last = _runs.size() - 1;
+			const run_type&	older = _runs[last - 1];
+			const run_type&	newer = _runs[last];
+			bool	drop = last == 1;
+			run_type	merged(older.get_allocator());
+			merged.reserve(older.size() + newer.size());
+			size_type	a = 0;
+			size_type	b = 0;
+			while (a < older.size() || b < newer.size()) {
+				const entry_type* e;
+				if (b == newer.size() || (a < older.size() && _comp(older[a]._data.first, newer[b]._data.first)))
+					e = &older[a++];
+				else {
+					if (a < older.size() && !_comp(newer[b]._data.first, older[a]._data.first))
+						++a;			// same key: the older record is shadowed
+					e = &newer[b++];
+				}
+				if (!(drop && e->_erased))
+					merged.push_back(*e);
+			}
+			_runs.pop_back();
+			_runs.back().swap(merged);
+		}
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator == (const lsm_map<Key, T, Compare, Alloc>& lhs, const lsm_map<Key, T, Compare, Alloc>& rhs) {
+		typename lsm_map<Key, T, Compare, Alloc>::const_iterator a = lhs.begin();
+		typename lsm_map<Key, T, Compare, Alloc>::const_iterator b = rhs.begin();
+		for (; a != lhs.end() && b != rhs.end(); ++a, ++b)
+			if (!(*a == *b))
+				return false;
+		return a == lhs.end() && b == rhs.end();
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator != (const lsm_map<Key, T, Compare, Alloc>& lhs, const lsm_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator < (const lsm_map<Key, T, Compare, Alloc>& lhs, const lsm_map<Key, T, Compare, Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator <= (const lsm_map<Key, T, Compare, Alloc>& lhs, const lsm_map<Key, T, Compare, Alloc>& rhs) {
+		return !(rhs < lhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator > (const lsm_map<Key, T, Compare, Alloc>& lhs, const lsm_map<Key, T, Compare, Alloc>& rhs) {
+		return rhs < lhs; }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator >= (const lsm_map<Key, T, Compare, Alloc>& lhs, const lsm_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs < rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (lsm_map<Key, T, Compare, Alloc>& lhs, lsm_map<Key, T, Compare, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
@@ -1,43 +1,35 @@
 #ifndef _MAP_HPP_
 #define _MAP_HPP_
 
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <iostream>
+#include "vector.hpp"
 #include "../inc/pair.hpp"
 #include "../inc/bidirectional_iterator.hpp"
 #include "../inc/reverse_iterator.hpp"
 #include "../inc/lex_compare.hpp"
+#include "../inc/tree_node.hpp"
+#include "../inc/node_handle.hpp"
+#include "frozen_map.hpp"
+#include "../inc/compare.hpp"
+#include "../inc/node_pool_allocator.hpp"
+#include "../inc/arena_allocator.hpp"
+#include "../inc/enable_if.hpp"
+#include "../inc/index_sort.hpp"
 
 namespace ft {
 
-	/*----------*/
- /**	NODE:  */
-/*----------*/
-
-	template <class T>
- 	struct TNode {
-
-		typedef T								value_type;			
-		typedef TNode*					Node;
-		typedef std::size_t			size_type;
-		typedef std::ptrdiff_t	difference_type;
-
-		value_type	_data;
-		Node				_left;
-		Node				_right;
-		Node				_parent;
-		int					_height;
-	
-		TNode(value_type data, Node left, Node right, Node parent, size_type height)	:
-		_data(data), _left(left), _right(right), _parent(parent), _height(height){}
-	};
-
 	/*---------*/
  /**	MAP:  */
 /*---------*/
 
-template <class Key, 
-					class T, 
+template <class Key,
+					class T,
 					class Compare = std::less<Key>,
-		   		class Alloc = std::allocator<TNode<ft::pair<const Key, T> > >
+		   		class Alloc = std::allocator<TNode<ft::pair<const Key, T> > >,
+					class Policy = ft::tree_policy<>
 > class map {
 
 	public:
@@ -73,8 +65,11 @@ template <class Key,
 		typedef typename Alloc::const_pointer																			const_pointer;
 		typedef typename Alloc::reference																					reference;
 		typedef typename Alloc::const_reference																		const_reference;
-		typedef ft::TNode<value_type>																							node_type;
-		typedef ft::TNode<value_type>*																						Node;		
+		typedef Policy																														policy_type;
+		typedef typename Policy::balance_type																			balance_type;
+		typedef typename Policy::augment_type																			augment_type;
+		typedef ft::TNode<value_type, Policy>																			node_type;
+		typedef node_type*																												Node;
 		typedef typename Alloc::template rebind<node_type>::other									node_allocator_type;
 		typedef typename ft::bidirectional_iterator<value_type, node_type>				iterator;
 		typedef typename ft::bidirectional_iterator<const value_type, node_type> 	const_iterator;
@@ -82,13 +77,22 @@ template <class Key,
 		typedef typename ft::reverse_iterator<const_iterator>											const_reverse_iterator;
 		typedef std::ptrdiff_t																										difference_type;
 		typedef std::size_t																												size_type;
+		typedef ft::node_handle<node_type, node_allocator_type>										node_handle;
+		typedef ft::frozen_map<Key, T, Compare,
+							typename Alloc::template rebind<value_type>::other>								frozen_type;
+
+/** @insert_return_type: what insert(node_handle) did; the handle gets
+ *	the node back when its key was already in the map */
+		struct insert_return_type {
+			iterator		position;
+			bool				inserted;
+			node_handle	node;
+		};
 
 	private:
-		Node 								_root;
-		Node								_nil;
+		Node								_header;
 		size_type						_size;
 		Compare							_comp;
-		allocator_type			_alloc;
 		node_allocator_type _node_alloc;
 
 public:
@@ -97,13 +101,10 @@ public:
 /*---------------------*/
 
 /**	CONSTRUCTOR: 	*/
-		explicit map (const key_compare& comp = key_compare(), 
+		explicit map (const key_compare& comp = key_compare(),
 									const allocator_type& alloc = allocator_type()) :
-		_root(NULL), _nil(NULL), _size(0), _comp(comp), _alloc(alloc) {
-
-		_nil = _node_alloc.allocate(1);
-		_node_alloc.construct(_nil, node_type(value_type(), NULL, NULL, NULL, 1));
-		_root = _nil;
+		_header(NULL), _size(0), _comp(comp), _node_alloc(alloc) {
+		_init_header();
 	}
 
 	// range
@@ -111,27 +112,18 @@ public:
 	map		(InputIterator first, InputIterator last,
 				const key_compare& comp = key_compare(),
 		 		const allocator_type& alloc = allocator_type()) :
-				_size(0), _comp(comp), _alloc(alloc) {
-
-		_nil = _node_alloc.allocate(1);
-		_node_alloc.construct(_nil, node_type(value_type(), NULL, NULL, NULL, 1));
-		_root = _nil;
-
+				_header(NULL), _size(0), _comp(comp), _node_alloc(alloc) {
+		_init_header();
 		insert(first,last);
 	}
 
 	// copy
 	map (const map& x) :
-		_root(NULL),
-		_nil(NULL),
+		_header(NULL),
 		_size(0),
 		_comp(x._comp),
-		_alloc(x._alloc) {
-		
-		_nil = _node_alloc.allocate(1);
-		_node_alloc.construct(_nil, node_type(value_type(), NULL, NULL, NULL, 1));
-	
-		_root = _nil;
+		_node_alloc(x._node_alloc) {
+		_init_header();
 		*this = x;
 	}
 
@@ -139,20 +131,25 @@ public:
 	// destructor
 	~map(){
 		clear();
-		_node_alloc.destroy(_nil);
-		_node_alloc.deallocate(_nil, 1);
+		_node_alloc.destroy(_header);
+		_node_alloc.deallocate(_header, 1);
 	}
 
 	// Assigns new contents to the container, replacing its current content
 	map& operator= (const map& x) {
 		// self assignment check
 		if (this == &x) { return *this; }
- 		
+
 		// previous elements are erased
 		clear();
-		
+
 		// copy all elements
-		_copy(_root, x._root, NULL, x._nil);
+		if (x._root() != NULL) {
+			_root() = _copy(x._root(), _header);
+			_header->_left = node_type::minimum(_root());
+			_header->_right = node_type::maximum(_root());
+			node_type::rethread(_header);
+		}
 		_size = x._size;
 
 		return *this;
@@ -165,45 +162,24 @@ public:
 /**iterator to begin
  * Returns an iterator to the first element in the map container;
  * Because map keeps its elements sorted, begin() points to the
- * smallest element (crescent sorting); */
-	iterator begin() {
-		if (empty()) {
-			return iterator(_nil, _root, _nil);
-		} 
-		return iterator(minimum(_root), _root, _nil);
-	}
+ * smallest element (crescent sorting); the header keeps track of it */
+	iterator begin() { return iterator(_header->_left); }
+
+	const_iterator begin() const { return const_iterator(_header->_left); }
 
-	const_iterator begin() const {
-		if (empty()) {
-			return const_iterator(_nil, _root, _nil);
-		}
-		return const_iterator(minimum(_root), _root, _nil);
-	}
-	
 /**iterator to end
  * Returns an iterator to the theoretical element that would
- * follow the last element in the container;
- * If container is empty() return begin() */
-	iterator end() {
-		// Returning begin() here if the container is empty will turns impossible to compare end() with find() if element was not found;
-		// In the cont_iterator end() however, it is mandatory or it will return an error;
-		if (empty()) { return begin(); }
-		return iterator(_nil, _root, _nil);
-	}
+ * follow the last element in the container: the header node;
+ * If container is empty() begin() is the header too */
+	iterator end() { return iterator(_header); }
+
+	const_iterator end() const { return const_iterator(_header); }
 
-	const_iterator end() const {
-		if (empty()) return begin(); 
-		return const_iterator(_nil, _root, _nil);
-	}
 //	reverse-iterator to begin-end
-		reverse_iterator rbegin() {
-			return reverse_iterator(iterator(_nil, _root, _nil)); }
-		const_reverse_iterator rbegin() const {
-			return reverse_iterator(const_iterator(_nil, _root, _nil)); }
-		reverse_iterator rend() { if (empty()) return rbegin();
-			return reverse_iterator(iterator(minimum(_root), _root,_nil));	}
-		const_reverse_iterator rend() const {	if (empty()) return rbegin();
-			return const_reverse_iterator(const_iterator(minimum(_root), _root, _nil)); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
 /**END_ITERATORS	-----------------------------------------------------------***/
 
 
@@ -212,35 +188,44 @@ public:
 	bool empty() const { return _size == 0;	}
 	size_type size() const { return _size; }
 	// max_size is a public member function of std::allocator
-	size_type max_size() const { return _alloc.max_size(); }
+	size_type max_size() const { return _node_alloc.max_size(); }
+
+	/** Prepares the node allocator for 'n' elements in total, so inserting
+	 *	up to n does not allocate one by one (ft::node_pool_allocator
+	 *	carves them in one slab); a no-op for plain allocators */
+	void reserve(size_type n) {
+		if (n > _size)
+			ft::pool_traits<node_allocator_type>::reserve(_node_alloc, n - _size);
+	}
 /**END_CAPACITY	-----------------------------------------------------------***/
 
 
 /** ELEMENT:ACCESS:	------------------------------------------------------***/
 
 	mapped_type& operator[] (const key_type& k) {
+		_check_writable_values();
 		/** 'k' matches the key of an element in the container */
 		iterator it = find(k) ;
-		if (it != end()) {	return it._node->_data.second; }
+		if (it != end()) {	return it->second; }
 
 		/** 'k' does not match the key of any element in the container,
 		 * the function inserts a new element with that key */
 		ft::pair<iterator, bool> pair;
 		pair = insert(ft::make_pair(k, mapped_type()));
 		it = pair.first;
-		return it._node->_data.second;
+		return it->second;
 	}
 
 	mapped_type& at (const key_type& k) {
    	/** 'k' matches the key of an element in the container */
     iterator it = find(k) ;
-    if (it != end()) {      return it._node->_data.second; }
+    if (it != end()) {      return it->second; }
     else throw std::out_of_range("map::at: out of range");
         }
 
   const mapped_type& at (const key_type& k) const{
 		const_iterator it = find(k) ;
-    if (it != end()) { return it._node->_data.second; }
+    if (it != end()) { return it->second; }
     else throw std::out_of_range("map::at: out of range");
   }
 
@@ -256,32 +241,34 @@ public:
 	 * if key already exists, the new element is not inserted and
 	 * an iterator pointing to the the existing element is returned
 	 */
-		iterator it = find(val.first);
-		if (it != end())
-			return ft::make_pair(it, false);
-
-		Node node = _node_alloc.allocate(1);
-		_node_alloc.construct(node, node_type(val, _nil, _nil, NULL, 1));
-		it = iterator(_insert(node), _root, _nil);
-		balance(it._node);
-
-		_size++;
-		return ft::make_pair(it, true);
+		bool left;
+		Node parent = _find_slot(val.first, left);
+		if (parent == NULL)
+			return ft::make_pair(find(val.first), false);
+
+		Node node = _create_node(val);
+		_insert(node, parent, left);
+		return ft::make_pair(iterator(node), true);
 	}
 
 
 	//hint
+	/** If 'val' goes right before 'pos' it is linked next to it
+	 *	without searching the tree from the root */
 	iterator insert (iterator pos, const value_type& val) {
-
-		if (_comp(pos._node->_data.first, val.first)) {
-			Node node = _node_alloc.allocate(1);
-			_node_alloc.construct(node, node_type(val, _nil, _nil, NULL, 1));
-			iterator(_insert(node), _root, _nil);
-			if (_size > 2) balance(pos._node);
-			_size++;
-			return iterator(node, _root, _nil);
-		}
-		return insert(val).first;
+		Node hint = pos._node;
+		if (_size == 0 || (hint != _header->_left && !_comp(node_type::decrement(hint)->_data.first, val.first))
+				|| (hint != _header && !_comp(val.first, hint->_data.first)))
+			return insert(val).first;
+
+		Node node = _create_node(val);
+		if (hint == _header)
+			_insert(node, _header->_right, false);
+		else if (hint->_left == NULL)
+			_insert(node, hint, true);
+		else
+			_insert(node, node_type::decrement(hint), false);
+		return iterator(node);
 	}
 
 	//range
@@ -293,9 +280,7 @@ public:
 	//erase
 	void erase(iterator position) {
 		if (empty() || position == end()) return;
-		position._node = _erase(position._node);
-		if (_size > 2) balance(position._node);
-		--_size;
+		_erase(position._node);
 	}
 
 	size_type erase(const key_type& k) {
@@ -308,428 +293,947 @@ public:
 	void erase(iterator first, iterator last) {
 		while(first != last) { erase(first++);	}
 	}
-	
-	void swap(map& x) {
-		Node tmp = _root;
-		_root = x._root;
-		x._root = tmp;
 
-		Node nil = _nil;
-		_nil = x._nil;
-		x._nil = nil;
+	/** Unlinks the element from the tree without destroying it: the handle
+	 *	owns it from there. Other iterators stay valid */
+	node_handle extract(iterator position) {
+		Node node = position._node;
+		_unlink(node);
+		return node_handle(node, _node_alloc);
+	}
+
+	/** an empty handle if 'k' is not in the map */
+	node_handle extract(const key_type& k) {
+		iterator it = find(k);
+		if (it == end())
+			return node_handle();
+		return extract(it);
+	}
+
+	/** Links the handle's node in place when the allocators compare equal,
+	 *	or moves its element into a node of this map's own otherwise; an
+	 *	element with the same key is left alone and the handle keeps its node */
+	insert_return_type insert(node_handle nh) {
+		insert_return_type	r;
+		r.inserted = false;
+		r.position = end();
+		if (nh.empty())
+			return r;
+
+		bool	left;
+		Node	parent = _find_slot(nh.key(), left);
+		if (parent == NULL) {
+			r.position = find(nh.key());
+			r.node = nh;
+			return r;
+		}
+		Node node;
+		if (nh.get_allocator() == _node_alloc)
+			node = nh.release();
+		else
+			node = _create_node(nh.value());
+		_relink(node, parent, left);
+		r.position = iterator(node);
+		r.inserted = true;
+		return r;
+	}
+
+	/** Moves the elements of 'other' whose key is not here yet, relinking
+	 *	their nodes when the allocators compare equal (no copy, no
+	 *	allocation); the others stay in 'other' */
+	void merge(map& other) {
+		if (this == &other)
+			return;
+		bool	same_alloc = other._node_alloc == _node_alloc;
+		for (Node node = other._header->_left; node != other._header; ) {
+			Node	next = node_type::increment(node);
+			bool	left;
+			Node	parent = _find_slot(node->_data.first, left);
+			if (parent != NULL) {
+				if (same_alloc) {
+					other._unlink(node);
+					_relink(node, parent, left);
+				}
+				else {
+					_insert(_create_node(node->_data), parent, left);
+					other._erase(node);
+				}
+			}
+			node = next;
+		}
+	}
+
+	/** The header is heap allocated, so iterators stay valid across swap;
+	 *	the nodes go along with the allocators that own them */
+	void swap(map& x) {
+		Node tmp = _header;
+		_header = x._header;
+		x._header = tmp;
 
 		size_type s = _size;
 		_size = x._size;
 		x._size = s;
+
+		Compare comp = _comp;
+		_comp = x._comp;
+		x._comp = comp;
+
+		node_allocator_type node_alloc = _node_alloc;
+		_node_alloc = x._node_alloc;
+		x._node_alloc = node_alloc;
 	}
 
-	void clear() { clear(_root); _root = _nil; }
+	/** Nodes are destroyed one by one, unless the allocator gives its memory
+	 *	back in bulk (ft::arena_allocator) and destroying them runs no code:
+	 *	then the tree is simply dropped */
+	void clear() {
+		if (!ft::pool_traits<node_allocator_type>::bulk_release
+				|| !ft::is_trivially_destructible<node_type>::value)
+			clear(_root());
+		_size = 0;
+		_root() = NULL;
+		_header->_left = _header;
+		_header->_right = _header;
+		node_type::reset(_header);
+	}
 
-	key_compare key_comp() const { return key_compare(); }
-	value_compare value_comp() const { return key_compare(); }
+	key_compare key_comp() const { return _comp; }
+	value_compare value_comp() const { return value_compare(_comp); }
 
 	iterator find(const key_type& key) {
-		Node node = find_node(key, _root);
+		Node node = _find_node(key);
 		if (node)
-			return iterator(node, _root, _nil);
+			return iterator(node);
 		return end();
 	}
 
 	const_iterator find(const key_type& key) const {
-		Node node = find_node(key, _root);
+		Node node = _find_node(key);
 		if (node)
-			return const_iterator(node, _root, _nil);
+			return const_iterator(node);
 		return end();
 	}
 
-	size_type count(const key_type& k) const {
-		if (find(k) != end()) return 1; 
-		return 0;
+/** BATCHED:LOOKUPS:	***/
+	/** @brief find() for every key of [first, last), written to 'out' in the
+	 *	same order (end() for a missing key). Up to 'batch_lanes' searches go
+	 *	down the tree together, one level each per round, and each prefetches
+	 *	its next node: the misses of the lanes overlap instead of stalling one
+	 *	after the other. With 'sort_keys' the keys are looked up in sorted
+	 *	order, so neighbouring lanes share the top of their paths; that pays
+	 *	for big batches of scattered keys. The keys must stay in place while
+	 *	the call runs (a forward range). */
+	template <class ForwardIterator, class OutputIterator>
+	OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out, bool sort_keys = false) {
+		return _find_batch<iterator>(first, last, out, sort_keys);
 	}
 
+	template <class ForwardIterator, class OutputIterator>
+	OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out, bool sort_keys = false) const {
+		return _find_batch<const_iterator>(first, last, out, sort_keys);
+	}
+
+	size_type count(const key_type& k) const { return _find_node(k) != NULL; }
+
 	/** Returns an iterator to the first element whose key
 	 *	is greater than k */
 	iterator upper_bound(const key_type& k) {
-		iterator it = begin();
-		iterator it_end = end();
+		Node node = _upper_node(k);
+		return node ? iterator(node) : end();
+	}
+
+	const_iterator upper_bound(const key_type& k) const {
+		Node node = _upper_node(k);
+		return node ? const_iterator(node) : end();
+	}
+
+	/** Returns an iterator to the first element whose key
+	 *	is not less than k */
+	iterator lower_bound(const key_type& k) {
+		Node node = _lower_node(k);
+		return node ? iterator(node) : end();
+	}
 
-		while (it != it_end) {
-			if (_comp(k, it._node->_data.first))
-				return it;
-			it++;
+	const_iterator lower_bound(const key_type& k) const {
+		Node node = _lower_node(k);
+		return node ? const_iterator(node) : end();
+	}
+
+	pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+	pair<iterator, iterator> equal_range (const key_type& k) {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+
+/** HETEROGENEOUS:LOOKUP: only when Compare::is_transparent is a type
+ *	(ft::transparent_less): any K the comparator takes against key_type is
+ *	looked up as is, without building a key_type	***/
+	template <class K>
+	typename ft::enable_transparent<Compare, K, iterator>::type find(const K& k) {
+		Node node = _find_node(k);
+		return node ? iterator(node) : end();
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, const_iterator>::type find(const K& k) const {
+		Node node = _find_node(k);
+		return node ? const_iterator(node) : end();
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, size_type>::type count(const K& k) const {
+		return _find_node(k) != NULL;
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, iterator>::type lower_bound(const K& k) {
+		Node node = _lower_node(k);
+		return node ? iterator(node) : end();
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, const_iterator>::type lower_bound(const K& k) const {
+		Node node = _lower_node(k);
+		return node ? const_iterator(node) : end();
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, iterator>::type upper_bound(const K& k) {
+		Node node = _upper_node(k);
+		return node ? iterator(node) : end();
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, const_iterator>::type upper_bound(const K& k) const {
+		Node node = _upper_node(k);
+		return node ? const_iterator(node) : end();
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, pair<iterator, iterator> >::type equal_range(const K& k) {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, pair<const_iterator, const_iterator> >::type equal_range(const K& k) const {
+		return ft::make_pair(lower_bound(k), upper_bound(k));
+	}
+
+	template <class K>
+	typename ft::enable_transparent<Compare, K, size_type>::type erase(const K& k) {
+		iterator it = find(k);
+		if (it == end()) return 0;
+		erase(it);
+		return 1;
+	}
+
+	/** a key_type is only built when 'k' has to be inserted */
+	template <class K>
+	typename ft::enable_transparent<Compare, K, mapped_type&>::type operator[] (const K& k) {
+		_check_writable_values();
+		iterator it = find(k);
+		if (it != end())
+			return it->second;
+		return insert(ft::make_pair(key_type(k), mapped_type())).first->second;
+	}
+
+/** ORDER:STATISTICS: only with ft::order_statistics in the policy	***/
+	/** element of rank 'k' (0 is begin()), end() if k >= size() */
+	iterator nth(size_type k) {
+		Node node = node_type::select(_root(), k);
+		return node ? iterator(node) : end();
+	}
+
+	const_iterator nth(size_type k) const {
+		Node node = node_type::select(_root(), k);
+		return node ? const_iterator(node) : end();
+	}
+
+	/** number of elements whose key is less than k */
+	size_type rank(const key_type& k) const {
+		size_type r = 0;
+		for (Node node = _root(); node != NULL; ) {
+			if (_comp(node->_data.first, k)) {
+				r += node_type::count(node->_left) + 1;
+				node = node->_right;
+			}
+			else
+				node = node->_left;
 		}
-		return end();
+		return r;
 	}
 
-	const_iterator upper_bound(const key_type& k) const{
-		const_iterator it = begin();
-		const_iterator it_end = end();
+	/** position of 'it' in order: rank(it->first), size() for end() */
+	size_type rank(const_iterator it) const { return node_type::rank(it._node); }
 
-		while (it != it_end) {
-			if (_comp(k, it._node->_data.first))
-				return it;
-			it++;
+	/** number of elements whose key is in [lo, hi) */
+	size_type count_range(const key_type& lo, const key_type& hi) const {
+		if (!_comp(lo, hi))
+			return 0;
+		return rank(hi) - rank(lo);
+	}
+
+/** AGGREGATION: only with ft::monoid_augment<Reducer> in the policy	***/
+	typedef typename augment_type::result_type		aggregate_type;
+
+	/** the reduction of all the elements */
+	aggregate_type aggregate() const { return node_type::aggregate_of(_root()); }
+
+	/** @brief The reduction of the elements whose key is in [lo, hi), in order.
+	 *	Below the node where the searches for lo and hi part, each path takes
+	 *	the nodes it passes that fall inside the range along with their whole
+	 *	subtree on the inner side: O(log n) nodes in all. */
+	aggregate_type aggregate(const key_type& lo, const key_type& hi) const {
+		typedef typename augment_type::reducer_type	reducer;
+
+		Node split = _root();
+		while (split != NULL) {
+			split->push();
+			if (_comp(split->_data.first, lo))
+				split = split->_right;
+			else if (!_comp(split->_data.first, hi))
+				split = split->_left;
+			else
+				break;
 		}
-		return end();
+		if (split == NULL)
+			return reducer::identity();
+
+		aggregate_type left = reducer::identity();
+		for (Node node = split->_left; node != NULL; ) {
+			node->push();
+			if (_comp(node->_data.first, lo))
+				node = node->_right;
+			else {
+				left = reducer::combine(reducer::combine(node_type::lift(node), node_type::aggregate_of(node->_right)), left);
+				node = node->_left;
+			}
+		}
+		aggregate_type right = reducer::identity();
+		for (Node node = split->_right; node != NULL; ) {
+			node->push();
+			if (_comp(node->_data.first, hi)) {
+				right = reducer::combine(right, reducer::combine(node_type::aggregate_of(node->_left), node_type::lift(node)));
+				node = node->_right;
+			}
+			else
+				node = node->_left;
+		}
+		return reducer::combine(reducer::combine(left, node_type::lift(split)), right);
 	}
 
-	iterator lower_bound(const key_type& k) {
-		iterator it = begin();
-		iterator it_end = end();
-		while (it != it_end) {
-			if (_comp(k, it._node->_data.first) || k == it._node->_data.first)
-				return it;
-			it++;
+	/** gives 'pos' a new mapped value and refreshes the subtree data above it:
+	 *	the way to change a value the augmentation depends on */
+	void update(iterator pos, const mapped_type& val) {
+		pos->second = val;
+		_pull_path(pos._node);
+	}
+
+/** RANGE:UPDATES: only with ft::range_add<T> in the policy	***/
+	/** adds 'delta' to the value of every element whose key is in [lo, hi):
+	 *	O(log n), whole subtrees only get a pending tag */
+	void add(const key_type& lo, const key_type& hi, const mapped_type& delta) {
+		if (_comp(lo, hi))
+			_add(_root(), lo, hi, delta, false, false);
+	}
+
+/** SPLIT:JOIN:SET:OPERATIONS: as with merge(), nodes move between the maps
+ *	when their allocators compare equal (std::allocator always does), none
+ *	is copied; otherwise the elements are copied into the receiving map
+ *	and destroyed in the other, one at a time.
+ *	A threaded map relinks its neighbour ring afterwards, in O(size)	***/
+	/** keeps the elements whose key is less than 'k' and moves the others
+	 *	into 'greater', whose previous content is cleared: O(log n) with
+	 *	ft::order_statistics, plus a count of the moved elements otherwise */
+	void split(const key_type& k, map& greater) {
+		greater.clear();
+		if (!(greater._node_alloc == _node_alloc)) {
+			iterator first = lower_bound(k);
+			greater.insert(first, end());
+			erase(first, end());
+			return;
 		}
-		return end();
+		Node less;
+		Node more;
+		Node found = _split(_root(), k, less, more);
+		if (found)
+			more = _join(NULL, found, more);
+		size_type moved = _count(more);
+		_adopt(less);
+		_size -= moved;
+		greater._adopt(more);
+		greater._size = moved;
 	}
 
-	const_iterator lower_bound(const key_type& k) const {
-		const_iterator it = begin();
-		const_iterator it_end = end();
+	/** moves every element of 'greater' into this map: O(log n) when they
+	 *	all come after this map's last one, a set_union() otherwise */
+	void join(map& greater) {
+		if (greater.empty() || this == &greater)
+			return;
+		if (!(greater._node_alloc == _node_alloc)
+				|| (!empty() && !_comp(_header->_right->_data.first, greater._header->_left->_data.first))) {
+			set_union(greater);
+			return;
+		}
+		Node more = greater._root();
+		_size += greater._size;
+		greater._release();
+		_adopt(_join(_root(), more));
+	}
 
-		while (it != it_end) {
-			if (_comp(k, it._node->_data.first) || k == it._node->_data.first)
-				return it;
-			it++;
+	/** moves the elements of 'other' with a new key into this map, destroying
+	 *	the others (this map's values win): O(m log(n / m + 1)) for the
+	 *	smaller size m under avl_balance, instead of m inserts from the root */
+	void set_union(map& other) {
+		if (this == &other)
+			return;
+		if (!(other._node_alloc == _node_alloc)) {
+			insert(other.begin(), other.end());
+			other.clear();
+			return;
 		}
-		return end();
+		size_type	dups = 0;
+		size_type	moved = other._size;
+		Node			root = _union(_root(), other._root(), dups);
+		other._release();
+		_size += moved - dups;
+		_adopt(root);
 	}
 
-	pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
-		return ft::make_pair(lower_bound(k), upper_bound(k));
+	/** keeps only the elements whose key is also in 'other' */
+	void set_intersection(const map& other) {
+		if (this != &other)
+			_adopt(_intersect(_root(), other._root()));
 	}
-	pair<iterator, iterator> equal_range (const key_type& k) {
-		return ft::make_pair(lower_bound(k), upper_bound(k));
+
+	/** erases the elements whose key is in 'other' */
+	void set_difference(const map& other) {
+		if (this == &other)
+			clear();
+		else
+			_adopt(_difference(_root(), other._root()));
 	}
+
+/** FREEZING:	***/
+	/** read-only copy for lookups once the map is done changing: the keys
+	 *	in Eytzinger order, the values beside them (see frozen_map.hpp).
+	 *	The map itself is left as it is; the copy uses its allocator. */
+	frozen_type freeze() const {
+		return frozen_type(ft::sorted_unique, begin(), end(), _comp,
+											typename frozen_type::allocator_type(get_allocator()));
+	}
+
 /** END_OPERATIONS	-------------------------------------------------------***/
 
 /** ALLOCATOR:	-----------------------------------------------------------***/
-	allocator_type get_allocator() const { return _alloc;	}
+	/** the node allocator rebound to value_type: the one owning the nodes */
+	allocator_type get_allocator() const { return allocator_type(_node_alloc);	}
 /** END_ALLOCATOR	---------------------------------------------------------***/
 /**END_MEMBER FUNCTIONS	-----------------------------------------------------------***/
 
-private: 
-//_balance() gives us the info about how many more nodes
-//a branch has relatively to the opposite one
-	int _balance(Node node) {	return (height(node->_left) - height(node->_right)); }
+private:
+/**	@header: holds no element; root is its _parent, leftmost its _left
+ *	and rightmost its _right. An empty tree points both ends back at it */
+	void _init_header() {
+		_header = _node_alloc.allocate(1);
+		_node_alloc.construct(_header, node_type(value_type(), NULL, NULL, NULL, -1));
+		_header->_left = _header;
+		_header->_right = _header;
+		node_type::reset(_header);
+	}
 
-	void balance(Node node) {
-//	iterate through the tree from last inserted node to _root
-		while(node != NULL) {
-	//	Rotate if needed
+	Node& _root() const { return _header->_parent; }
 
-			int balance = _balance(node);
+	Node _create_node(const value_type& val) {
+		Node node = _node_alloc.allocate(1);
+		_node_alloc.construct(node, node_type(val, NULL, NULL, NULL, balance_type::leaf));
+		return node;
+	}
 
-			if(balance > 1 && _balance(node->_left) > 0) { 
-				node = rotateRight(node);
-			}
-			else if(balance < -1 && _balance(node->_right) < 1) { 
-				node = rotateLeft(node);
-			}
-			else if(balance > 1 && _balance(node->_left) < 0) {
-				node->_left = rotateLeft(node->_left);
-				node = rotateRight(node);
-			}
-			else if ( balance < -1 && _balance(node->_right) > 0) {
-				node->_right = rotateRight(node->_right);
-				node = rotateLeft(node);
-			}
-			// re-adjust heights
-			height(node, _root);
-			if (node->_parent == NULL) {_root = node; }	
-			node = node->_parent;
-		}
+	void _destroy_node(Node node) {
+		_node_alloc.destroy(node);
+		_node_alloc.deallocate(node, 1);
 	}
 
-	void clear(const Node& node) {
-		if (node == _nil) { return; }
+	void clear(Node node) {
+		if (node == NULL) { return; }
 		clear(node->_left);
 		clear(node->_right);
-		_node_alloc.destroy(node);
-		_node_alloc.deallocate(node,1);
+		_destroy_node(node);
 		_size--;
 	}
 
-	void _copy(Node& node, Node copy, Node parent, Node end) {
-		/** while the node to be copied not equal its end node 
-		 * 	new nodes are being added left and right
-		 *	and the node parent is atualized */
-		if (copy == end) node = _nil;
-		else {
-			node = _node_alloc.allocate(1);
-			_node_alloc.construct(node, *copy);
-			node->_parent = parent;
-			_copy(node->_left, copy->_left, node, end);
-			_copy(node->_right, copy->_right, node, end);
-		}
+	/** copies the subtree 'copy' and hangs it from 'parent' */
+	Node _copy(Node copy, Node parent) {
+		if (copy == NULL) return NULL;
+		Node node = _node_alloc.allocate(1);
+		_node_alloc.construct(node, *copy);
+		node->_parent = parent;
+		node->_left = _copy(copy->_left, node);
+		node->_right = _copy(copy->_right, node);
+		return node;
 	}
 
-	Node _erase(Node node) {
+	/** points the link that held 'node' (parent child or root) at 'child' */
+	void _replace(Node node, Node child) { ft::tree_rotation::replace(node, child, _header); }
 
+	void _erase(Node node) {
+		_unlink(node);
+		_destroy_node(node);
+	}
+
+	/** takes 'node' out of the tree and rebalances; the node is left as is */
+	void _unlink(Node node) {
+/**	@header: the ends move to the in-order neighbour of the erased node */
 		if (_size == 1) {
-			_node_alloc.destroy(node);
-			_node_alloc.deallocate(node, 1);
-			_root = _nil;
-  		return NULL;
-		}
-  /*-------------*/
- /** @new_node: */
-/*-------------*/
-		Node new_node = NULL;
-		if (node->_left != _nil) { new_node = predecessor(node); }
-		else new_node = successor(node);
-
-  /*-------------*/
- /** @children: */
-/*-------------*/
-		Node child = NULL;
-		if (node->_left == _nil || node->_right == _nil) {
-
-			if (node->_left != _nil)
-				child = node->_left;
-			else if (node->_right != _nil)
-				child = node->_right;
-
-  /*-------------*/
- /** @no_child: */
-/*-------------*/
-			if (!child) {
-
-				if (node->_parent->_left == node) {
-					node->_parent->_left = _nil;
-				}
-				else if (node->_parent->_right == node)
-					node->_parent->_right = _nil;
-			}
-			else { // left-side
-
-   /*--------------*/
-	/**	@one_child: */ 
- /*--------------*/
-/**	@left_side: */
-				if (node->_parent == NULL) {
-					_root = new_node;
-					new_node->_parent = NULL;
-					_node_alloc.destroy(node);
-					_node_alloc.deallocate(node, 1);
-  				return new_node;
-				}
-				else if (node->_parent->_left == node) {
-					node->_parent->_left = child;
-					child->_parent = node->_parent;
-				}
-   /*--------------*/
-	/**	@one_child: */
- /*--------------*/
-/** @right_side:*/
-
-				else { // right-side
-					node->_parent->_right = child;
-					child->_parent = node->_parent;	
-				}
-			}
+			_header->_left = _header;
+			_header->_right = _header;
+		}
+		else if (_header->_left == node)
+			_header->_left = node_type::increment(node);
+		else if (_header->_right == node)
+			_header->_right = node_type::decrement(node);
+		node_type::unthread(node);
+
+/**	@lazy: the nodes that move (the successor, or the erased node's child)
+ *	must be up to date, and the erased node must not take debts with it */
+		if (node_type::lazy) {
+			Node moved = node->_left && node->_right ? node_type::minimum(node->_right) : node;
+			node_type::settle(moved);
+			moved->push();
 		}
 
+/**	@retrace: parent of the spot that lost a node, where rebalancing starts;
+ *	@child: what took that spot (maybe NULL); @removed: the _height that
+ *	left the tree (the successor's, which takes over the erased node's) */
+		Node retrace;
+		Node child;
+		int removed;
+  /*-------------------------*/
+ /** @no_child / @one_child: */
+/*-------------------------*/
+		if (node->_left == NULL || node->_right == NULL) {
+			child = node->_left ? node->_left : node->_right;
+			_replace(node, child);
+			retrace = node->_parent;
+			removed = node->_height;
+		}
   /*-----------------*/
  /** @two_children: */
-/*-----------------*/		
-		else { //two childrens
-			if (node->_parent == NULL) {
-				Node tmp = NULL;
-
-/**			@relink_root: */
-/** 		if the deleted node was root
-	* 		clean previous parent link 
-				new_node was assing as _root previously	*/
-				if (node->_left == new_node) {
-					new_node->_parent->_left = new_node->_left;
-				}
-				else {
-					if (new_node->_left != _nil) {
-						new_node->_parent->_right = new_node->_left;
-						new_node->_left->_parent = new_node->_parent;
-					}
-					else if (new_node->_left == _nil && new_node->_right == _nil)
-						tmp = new_node->_parent;
-				}
-				new_node->_parent = NULL;
+/*-----------------*/
+/**	the successor has no left child: unhook it and relink it in place of node */
+		else {
+			Node next = node_type::minimum(node->_right);
+			child = next->_right;
+			if (next->_parent != node) {
+				retrace = next->_parent;
+				_replace(next, child);
+				next->_right = node->_right;
+				next->_right->_parent = next;
+			}
+			else
+				retrace = next;
+			next->_left = node->_left;
+			next->_left->_parent = next;
+			removed = next->_height;
+			next->_height = node->_height;
+			_replace(node, next);
+		}
+		--_size;
+		_pull_path(retrace);
+		balance_type::erased(child, retrace, removed, _header);
+	}
 
-/**			@relink_new_node: */
-//			copy node links to new node
-				new_node->_left = node->_left;
-				new_node->_right = node->_right;
-				node->_left->_parent = new_node;
-				node->_right->_parent = new_node;
+	/** hangs a node out of another tree as a new leaf */
+	void _relink(Node node, Node parent, bool left) {
+		node->_left = NULL;
+		node->_right = NULL;
+		node->_height = balance_type::leaf;
+		_insert(node, parent, left);
+	}
 
-				if (tmp)	tmp->_right = _nil;
+	/** @brief Parent of the leaf 'key' would become, and on which side; NULL
+	 *	when the key is already in the tree. One comparison per level: the
+	 *	descent remembers the last node it passed on the right, the only one
+	 *	that can be equivalent to 'key', and checks it once at the bottom;
+	 *	a three-way comparator stops as soon as it meets the key */
+	Node _find_slot(const key_type& key, bool& left) const {
+		return _find_slot(key, left, ft::integral_constant<bool, ft::is_three_way<Compare>::value>());
+	}
+
+	Node _find_slot(const key_type& key, bool& left, ft::false_type) const {
+		Node parent = _header;
+		Node below = NULL;
+		left = true;
+		for (Node node = _root(); node != NULL; ) {
+			parent = node;
+			left = _comp(key, node->_data.first);
+			if (left)
+				node = node->_left;
+			else {
+				below = node;
+				node = node->_right;
 			}
-			else
-				_erase_relink(node, new_node);
 		}
-	 /*----------------*/
-	/**	@delete_node: */
- /*----------------*/
-		_node_alloc.destroy(node);
-		_node_alloc.deallocate(node, 1);
-  	return new_node;
+		if (below != NULL && !_comp(below->_data.first, key))
+			return NULL;
+		return parent;
 	}
 
-	void _erase_relink(Node node, Node new_node) {
-		Node tmp = new_node->_parent;
+	Node _find_slot(const key_type& key, bool& left, ft::true_type) const {
+		Node parent = _header;
+		left = true;
+		for (Node node = _root(); node != NULL; ) {
+			int c = _comp.compare(key, node->_data.first);
+			if (c == 0)
+				return NULL;
+			parent = node;
+			left = c < 0;
+			node = left ? node->_left : node->_right;
+		}
+		return parent;
+	}
 
-		if (node->_parent->_left == node)
-			node->_parent->_left = new_node;
-		else
-			node->_parent->_right = new_node;
-			
-		if (tmp != node && new_node->_right != _nil) {
-			tmp->_right = new_node->_right;
-			tmp->_right->_parent = tmp;
-		}
-		else if (tmp != node && new_node->_left != _nil) {
-			tmp->_right = new_node->_left;
-			tmp->_right->_parent = tmp;
-		}
-
-		if (tmp != node) 
-			new_node->_left = node->_left;
-		new_node->_right = node->_right;
-		if (tmp->_right == new_node)
-			tmp->_right = _nil;
-		else if (tmp->_left == new_node)
-			tmp->_left = _nil;
-		new_node->_parent = node->_parent;
-		node->_right->_parent = new_node;
-		node->_left->_parent = new_node;	
-	}
-
-	Node find_node(const key_type& key, Node node) const{
-		while (node != _nil) {
-			if (node->_data.first == key) {	return node;	}
-			if (_comp(node->_data.first, key)) node = node->_right;
-			else	node = node->_left;
+	/** the node holding 'key', or NULL: a lower bound descent checked once at
+	 *	the bottom, so Compare is all it needs (no operator==), or a
+	 *	three-way descent that stops at the key */
+	template <class K>
+	Node _find_node(const K& key) const {
+		return _find_node(key, ft::integral_constant<bool, ft::is_three_way<Compare>::value>());
+	}
+
+	template <class K>
+	Node _find_node(const K& key, ft::false_type) const {
+		Node node = _lower_node(key);
+		return node != NULL && !_comp(key, node->_data.first) ? node : NULL;
+	}
+
+	template <class K>
+	Node _find_node(const K& key, ft::true_type) const {
+		for (Node node = _root(); node != NULL; ) {
+			int c = _comp.compare(key, node->_data.first);
+			if (c == 0)
+				return node;
+			node = c < 0 ? node->_left : node->_right;
 		}
 		return NULL;
 	}
 
-	Node find_parent(Node node, Node x) {
-		Node parent = NULL;
-		while (x != _nil) {
-			parent = x;
-			if (_comp(node->_data.first, x->_data.first)) {
-				x = x->_left;
+	static const size_type	batch_lanes = 8;
+
+	/** Searches for 'n' keys side by side. Each lane keeps the last node
+	 *	whose key was not less than its own and only checks equality at the
+	 *	bottom, so every lane takes one step per round until it falls off
+	 *	the tree. found[i] is the node holding *keys[i], or NULL */
+	void _descend(const key_type* const* keys, size_type n, Node* found) const {
+		Node	node[batch_lanes];
+		for (size_type i = 0; i < n; ++i) {
+			node[i] = _root();
+			found[i] = NULL;
+		}
+		for (bool active = _root() != NULL; active; ) {
+			active = false;
+			for (size_type i = 0; i < n; ++i) {
+				Node x = node[i];
+				if (x == NULL)
+					continue;
+				if (_comp(x->_data.first, *keys[i]))
+					x = x->_right;
+				else {
+					found[i] = x;
+					x = x->_left;
+				}
+				if (x != NULL) {
+					FT_PREFETCH(&x->_data);
+					active = true;
+				}
+				node[i] = x;
 			}
+		}
+		for (size_type i = 0; i < n; ++i)
+			if (found[i] != NULL && _comp(*keys[i], found[i]->_data.first))
+				found[i] = NULL;
+	}
+
+	template <class It, class ForwardIterator, class OutputIterator>
+	OutputIterator _find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out, bool sort_keys) const {
+		const key_type*	keys[batch_lanes];
+		Node						found[batch_lanes];
+
+		if (!sort_keys) {
+			while (first != last) {
+				size_type n = 0;
+				for (; n < batch_lanes && first != last; ++first)
+					keys[n++] = &*first;
+				_descend(keys, n, found);
+				for (size_type i = 0; i < n; ++i)
+					*out++ = It(found[i] != NULL ? found[i] : _header);
+			}
+			return out;
+		}
+		ft::vector<const key_type*>	all;
+		for (; first != last; ++first)
+			all.push_back(&*first);
+		ft::vector<size_type>	order;
+		ft::index_sort(all, all.size(), order, ft::indirect_compare<key_compare>(_comp));
+		ft::vector<Node>			result(all.size());
+		for (size_type start = 0; start < order.size(); start += batch_lanes) {
+			size_type n = order.size() - start < batch_lanes ? order.size() - start : batch_lanes;
+			for (size_type i = 0; i < n; ++i)
+				keys[i] = all[order[start + i]];
+			_descend(keys, n, found);
+			for (size_type i = 0; i < n; ++i)
+				result[order[start + i]] = found[i];
+		}
+		for (size_type i = 0; i < result.size(); ++i)
+			*out++ = It(result[i] != NULL ? result[i] : _header);
+		return out;
+	}
+
+	/** first node whose key is not less than 'k', NULL if none */
+	template <class K>
+	Node _lower_node(const K& k) const {
+		Node bound = NULL;
+		for (Node node = _root(); node != NULL; ) {
+			if (_comp(node->_data.first, k))
+				node = node->_right;
 			else {
-				x = x->_right;
+				bound = node;
+				node = node->_left;
 			}
 		}
-		return parent;
+		return bound;
+	}
+
+	/** first node whose key is greater than 'k', NULL if none */
+	template <class K>
+	Node _upper_node(const K& k) const {
+		Node bound = NULL;
+		for (Node node = _root(); node != NULL; ) {
+			if (_comp(k, node->_data.first)) {
+				bound = node;
+				node = node->_left;
+			}
+			else
+				node = node->_right;
+		}
+		return bound;
 	}
 
-	size_type height(Node node) {
-		if (node == _nil) return 0;
-		return node->_height;
+	/** 'node' is in a subtree whose keys are all >= lo if 'from_lo', and all
+	 *	< hi if 'to_hi': a subtree inside the range is tagged as a whole */
+	void _add(Node node, const key_type& lo, const key_type& hi, const mapped_type& delta, bool from_lo, bool to_hi) {
+		if (node == NULL)
+			return;
+		if (from_lo && to_hi) {
+			node_type::tag(node, delta);
+			return;
+		}
+		node->push();
+		bool above_lo = from_lo || !_comp(node->_data.first, lo);
+		bool below_hi = to_hi || _comp(node->_data.first, hi);
+		if (above_lo && below_hi) {
+			node->_data.second += delta;
+			_add(node->_left, lo, hi, delta, from_lo, true);
+			_add(node->_right, lo, hi, delta, true, to_hi);
+		}
+		else if (!above_lo)
+			_add(node->_right, lo, hi, delta, from_lo, to_hi);
+		else
+			_add(node->_left, lo, hi, delta, from_lo, to_hi);
+		node->pull();
 	}
 
-	void height(Node node, Node root) {
-		node->_height = std::max(height(node->_left), height(node->_right)) + 1;
-		root->_height = std::max(height(root->_left), height(root->_right)) + 1;
+	/** @brief Join-based tree surgery: subtrees are detached (their root's
+	 *	_parent is stale) and each join hangs its result under the header,
+	 *	which only stands in as the root's parent until _adopt(). */
+	Node _join(Node left, Node mid, Node right) {
+		return balance_type::join(left, mid, right, _header);
 	}
 
-	 Node _insert(Node node) {
-	 	node->_parent = find_parent(node, _root);
-	 	if (node->_parent == NULL)
-	 		_root = node;
-	 	else if(_comp(node->_data.first, node->_parent->_data.first))
-	 		node->_parent->_left = node;
-	 	else if(_comp(node->_parent->_data.first, node->_data.first))
-	 		node->_parent->_right = node;
-	 	return node;		
-	 }
+	/** joins two trees without a middle node: the last of 'left' becomes it */
+	Node _join(Node left, Node right) {
+		if (left == NULL)
+			return right;
+		if (right == NULL)
+			return left;
+		Node last;
+		left = _split_last(left, last);
+		return _join(left, last, right);
+	}
 
-	Node  maximum(Node  node) const {
-		while (node->_right != _nil)
-			return maximum(node->_right);
-		return node;
+	/** takes the last node out of the tree 'node' into 'last'; returns the rest */
+	Node _split_last(Node node, Node& last) {
+		node->push();
+		if (node->_right == NULL) {
+			last = node;
+			return node->_left;
+		}
+		Node rest = _split_last(node->_right, last);
+		return _join(node->_left, node, rest);
 	}
 
-	Node  minimum(Node  node) const{
-		if (node->_left != _nil)
-			return minimum(node->_left);
+	/** splits the tree 'node' into the keys less than 'k' and the keys
+	 *	greater; returns the node holding 'k', or NULL */
+	Node _split(Node node, const key_type& k, Node& less, Node& greater) {
+		if (node == NULL) {
+			less = NULL;
+			greater = NULL;
+			return NULL;
+		}
+		node->push();
+		Node left = node->_left;
+		Node right = node->_right;
+		if (_comp(k, node->_data.first)) {
+			Node found = _split(left, k, less, greater);
+			greater = _join(greater, node, right);
+			return found;
+		}
+		if (_comp(node->_data.first, k)) {
+			Node found = _split(right, k, less, greater);
+			less = _join(left, node, less);
+			return found;
+		}
+		less = left;
+		greater = right;
 		return node;
 	}
 
-	Node  predecessor(Node  node) {
+	/** splits 'other' around the root of 'node' and recurses on both sides;
+	 *	the nodes of 'other' with a key already here are destroyed */
+	Node _union(Node node, Node other, size_type& dups) {
+		if (node == NULL)
+			return other;
+		if (other == NULL)
+			return node;
+		node->push();
+		Node left = node->_left;
+		Node right = node->_right;
+		Node other_less;
+		Node other_greater;
+		Node dup = _split(other, node->_data.first, other_less, other_greater);
+		if (dup) {
+			_destroy_node(dup);
+			++dups;
+		}
+		left = _union(left, other_less, dups);
+		right = _union(right, other_greater, dups);
+		return _join(left, node, right);
+	}
 
-		if (node->_left != _nil)
-			return maximum(node->_left);
-		Node  x = node->_parent;
-		while (node->_parent != _root && node == x->_left) {
-			node = x;
-			x = x->_parent;
+	/** splits 'node' around each node of 'other', which is only read */
+	Node _intersect(Node node, Node other) {
+		if (node == NULL)
+			return NULL;
+		if (other == NULL) {
+			clear(node);
+			return NULL;
 		}
-		if (!x)	return _nil;
-		return x;
+		Node less;
+		Node greater;
+		Node found = _split(node, other->_data.first, less, greater);
+		less = _intersect(less, other->_left);
+		greater = _intersect(greater, other->_right);
+		return found ? _join(less, found, greater) : _join(less, greater);
 	}
 
-	Node  successor(Node  node) {
-		if (node->_right != _nil)
-			return minimum(node->_right);
-		Node  x = node->_parent;
-		while (node->_parent != _root && node == x->_right) {
-			node = x;
-			x = x->_parent;
+	Node _difference(Node node, Node other) {
+		if (node == NULL || other == NULL)
+			return node;
+		Node less;
+		Node greater;
+		Node found = _split(node, other->_data.first, less, greater);
+		if (found) {
+			_destroy_node(found);
+			--_size;
 		}
-		if (!x)	return _nil;
-		return x;
+		less = _difference(less, other->_left);
+		greater = _difference(greater, other->_right);
+		return _join(less, greater);
 	}
 
-	Node rotateLeft(Node node) {
+	/** elements in the subtree: kept in the nodes with order statistics,
+	 *	counted one by one otherwise */
+	size_type _count(Node node) const {
+		return _count(node, ft::integral_constant<bool, node_type::order_statistics>());
+	}
 
-		Node root = node->_right;
-		Node tmp = root->_left;
-		root->_left = node;
-		node->_right = tmp;
-		tmp->_parent = node;
-		height(node, _root);
-		// if rotate-left send dir true;
-		return re_link(node, root, 1);
+	size_type _count(Node node, ft::true_type) const { return node_type::count(node); }
+
+	size_type _count(Node node, ft::false_type) const {
+		return node == NULL ? 0 : 1 + _count(node->_left, ft::false_type()) + _count(node->_right, ft::false_type());
 	}
 
-	Node rotateRight(Node node) {
+	/** makes the detached tree 'root' this map's tree (the size is the
+	 *	caller's business) and rebuilds the header ends and the ring */
+	void _adopt(Node root) {
+		_root() = root;
+		if (root == NULL) {
+			_header->_left = _header;
+			_header->_right = _header;
+			node_type::reset(_header);
+			return;
+		}
+		root->_parent = _header;
+		balance_type::make_root(root);
+		_header->_left = node_type::minimum(root);
+		_header->_right = node_type::maximum(root);
+		node_type::rethread(_header);
+	}
 
-		Node root = node->_left;
-		Node tmp = root->_right;
-		root->_right = node;
-		node->_left = tmp;
-		tmp->_parent = node;
-		height(node, _root);
-		// if rotate-right send dir false;
-		return re_link(node, root, 0);
+	/** forgets the tree, whose nodes went to another map */
+	void _release() {
+		_size = 0;
+		_adopt(NULL);
 	}
 
-	Node re_link(Node node, Node root, bool dir) {
-		if (node->_parent == NULL) 
-			root->_parent = NULL;
+	/** operator[] only compiles when no summary reads the mapped values:
+	 *	writes through the reference it returns would leave them stale */
+	static void _check_writable_values() {
+		(void)sizeof(typename ft::enable_if<!node_type::reads_values, char>::type);
+	}
+
+	/** refreshes the augmented data from 'node' up to the root, before
+	 *	rebalancing (whose rotations keep it right from there) */
+	void _pull_path(Node node) {
+		if (!node_type::augmented)
+			return;
+		for (; node != _header; node = node->_parent)
+			node->pull();
+	}
+
+	/** links 'node' as a child of 'parent', keeps the header ends and rebalances */
+	void _insert(Node node, Node parent, bool left) {
+		if (node_type::lazy && parent != _header) {		// the new leaf must not get older updates
+			node_type::settle(parent);
+			parent->push();
+		}
+		node->_parent = parent;
+		node_type::thread(node, parent, left);
+		if (parent == _header) {
+			_root() = node;
+			_header->_left = node;
+			_header->_right = node;
+		}
+		else if (left) {
+			parent->_left = node;
+			if (_header->_left == parent)
+				_header->_left = node;
+		}
 		else {
-			root->_parent = node->_parent;
-			if (node->_parent->_left == node)
-				root->_parent->_left = root;
-			else if (node->_parent->_right == node)
-				root->_parent->_right = root;
-		}
-		node->_parent = root;
-		if (dir && node->_left)
-			node->_left->_parent = node;
-		else if (!dir && node->_right)
-			node->_right->_parent = node;
-		return node;
+			parent->_right = node;
+			if (_header->_right == parent)
+				_header->_right = node;
+		}
+		_size++;
+		_pull_path(node);
+		balance_type::inserted(node, _header);
 	}
 
 public:
 	void tree_printHelper(Node _root, std::string indent, bool last) {
-		if (_root != _nil) {
+		if (_root != NULL) {
 			std::cout << indent;
 			if (last) {
 				std::cout<<"R----";
@@ -746,8 +1250,8 @@ public:
 	}
 
 	void tree_print() {
-		if (_root) {
-			tree_printHelper(_root, "", true);
+		if (_root()) {
+			tree_printHelper(_root(), "", true);
 		}
 	}
 }; //end MAP
@@ -756,32 +1260,32 @@ public:
  /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
 /*-----------------------------------*/
 
-		template <class Key, class T, class Compare, class Alloc> 
-		bool operator == (const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+		template <class Key, class T, class Compare, class Alloc, class Policy>
+		bool operator == (const map<Key, T, Compare, Alloc, Policy>& lhs, const map<Key, T, Compare, Alloc, Policy>& rhs) {
 			if (lhs.size() == rhs.size())
 				return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 			return false;
 		}
 
-		template <class Key, class T, class Compare, class Alloc> 
-		bool operator != (const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+		template <class Key, class T, class Compare, class Alloc, class Policy>
+		bool operator != (const map<Key, T, Compare, Alloc, Policy>& lhs, const map<Key, T, Compare, Alloc, Policy>& rhs) {
 			return !(lhs	==	rhs); }
-		
+
 		// lexicographical_compare compares the elements sequentially (checking both a<b and b<a)
-		template <class Key, class T, class Compare, class Alloc> 
-		bool operator <	(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) { 
+		template <class Key, class T, class Compare, class Alloc, class Policy>
+		bool operator <	(const map<Key, T, Compare, Alloc, Policy>& lhs, const map<Key, T, Compare, Alloc, Policy>& rhs) {
 			return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
-	
-		template <class Key, class T, class Compare, class Alloc> 
-		bool operator <=	(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) { 
+
+		template <class Key, class T, class Compare, class Alloc, class Policy>
+		bool operator <=	(const map<Key, T, Compare, Alloc, Policy>& lhs, const map<Key, T, Compare, Alloc, Policy>& rhs) {
 			return !(lhs > rhs); }
-	
-		template <class Key, class T, class Compare, class Alloc> 
-		bool operator >	(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) { 
+
+		template <class Key, class T, class Compare, class Alloc, class Policy>
+		bool operator >	(const map<Key, T, Compare, Alloc, Policy>& lhs, const map<Key, T, Compare, Alloc, Policy>& rhs) {
 			return rhs < lhs; }
-	
-		template <class Key, class T, class Compare, class Alloc> 
-		bool operator >=	(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) { 
+
+		template <class Key, class T, class Compare, class Alloc, class Policy>
+		bool operator >=	(const map<Key, T, Compare, Alloc, Policy>& lhs, const map<Key, T, Compare, Alloc, Policy>& rhs) {
 			return !(lhs < rhs); }
 }
 
@@ -0,0 +1,435 @@
+#ifndef _PERSISTENT_MAP_HPP_
+#define _PERSISTENT_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "../inc/pair.hpp"
+#include "../inc/lex_compare.hpp"
+#include "../inc/atomic.hpp"
+#include "../inc/persistent_node.hpp"
+#include "../inc/persistent_iterator.hpp"
+#include "../inc/reverse_iterator.hpp"
+
+namespace ft {
+
+	/*--------------------*/
+ /**	PERSISTENT:MAP:  */
+/*--------------------*/
+
+/**	@brief AVL map whose versions share their nodes. Nodes are never changed
+ *	once linked: an insert or erase copies only the O(log n) nodes on the
+ *	path to the key (and those its rotations touch) and points the copies at
+ *	the untouched subtrees, which each gain a reference. Copying the map,
+ *	or snapshot(), is then O(1): the copy takes a reference on the root.
+ *	A version is let go of by dropping its root reference; a node is
+ *	destroyed when its last parent or version goes.
+ *	Threads: reference counts are atomic, so a snapshot taken by the writer
+ *	can be handed to reader threads, read and destroyed there while the
+ *	writer keeps updating its own map. A single map object is still not to
+ *	be changed from two threads at once.
+ *	Elements are const: there is no operator[]; insert_or_assign() replaces
+ *	a value by copying its path like any other update. */
+template <class Key,
+					class T,
+					class Compare = std::less<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class persistent_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef Compare														key_compare;
+
+/** @value_compare: compares the key of objects of type persistent_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class persistent_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::const_reference																		reference;
+		typedef typename Alloc::const_reference																		const_reference;
+		typedef typename Alloc::const_pointer																			pointer;
+		typedef typename Alloc::const_pointer																			const_pointer;
+		typedef ft::persistent_node<value_type>																		node_type;
+		typedef node_type*																												Node;
+		typedef typename Alloc::template rebind<node_type>::other									node_allocator_type;
+		typedef ft::persistent_iterator<value_type, node_type>										iterator;
+		typedef ft::persistent_iterator<value_type, node_type>										const_iterator;
+		typedef ft::reverse_iterator<const_iterator>															reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>															const_reverse_iterator;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+		Node									_root;
+		size_type							_size;
+		Compare								_comp;
+		allocator_type				_alloc;
+		node_allocator_type		_node_alloc;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit persistent_map (const key_compare& comp = key_compare(),
+														const allocator_type& alloc = allocator_type()) :
+		_root(NULL), _size(0), _comp(comp), _alloc(alloc), _node_alloc(alloc) {}
+
+		template <class InputIterator>
+		persistent_map (InputIterator first, InputIterator last,
+										const key_compare& comp = key_compare(),
+										const allocator_type& alloc = allocator_type()) :
+		_root(NULL), _size(0), _comp(comp), _alloc(alloc), _node_alloc(alloc) {
+			insert(first, last);
+		}
+
+	/** O(1): shares every node of 'x' */
+		persistent_map (const persistent_map& x) :
+		_root(_retain(x._root)), _size(x._size), _comp(x._comp), _alloc(x._alloc), _node_alloc(x._node_alloc) {}
+
+/**	DESTRUCTOR: 	*/
+		~persistent_map() { _release(_root); }
+
+	/** O(1), plus freeing whatever only this map's previous version held */
+		persistent_map& operator= (const persistent_map& x) {
+			if (this == &x) return *this;
+			Node root = _retain(x._root);
+			_release(_root);
+			_root = root;
+			_size = x._size;
+			_comp = x._comp;
+			return *this;
+		}
+
+	/** the current version, in O(1): later updates of this map do not show in it */
+		persistent_map snapshot() const { return *this; }
+
+/** ITERATORS:	***/
+		const_iterator begin() const {
+			const_iterator it(_root);
+			for (Node node = _root; node; node = node->_left)
+				it.push(node);
+			return it;
+		}
+		const_iterator end() const { return const_iterator(_root); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _size == 0; }
+		size_type size() const { return _size; }
+		size_type max_size() const { return _node_alloc.max_size(); }
+
+/** ELEMENT:ACCESS:	***/
+		const mapped_type& at (const key_type& k) const {
+			Node node = _find(k);
+			if (!node) throw std::out_of_range("persistent_map::at: out of range");
+			return node->_data.second;
+		}
+
+/** MODIFIERS:	***/
+	/** the new version shares all but the path to the new key */
+		pair<const_iterator, bool> insert (const value_type& val) {
+			bool inserted = false;
+			Node root = _insert(_root, val, false, inserted);
+			if (!root)
+				return ft::make_pair(find(val.first), false);
+			_replace(root);
+			++_size;
+			return ft::make_pair(find(val.first), true);
+		}
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+	/** inserts (k, obj), or gives 'k' the value 'obj' if it is already there */
+		pair<const_iterator, bool> insert_or_assign (const key_type& k, const mapped_type& obj) {
+			bool	inserted = false;
+			_replace(_insert(_root, value_type(k, obj), true, inserted));
+			_size += inserted;
+			return ft::make_pair(find(k), inserted);
+		}
+
+		size_type erase (const key_type& k) {
+			bool found = false;
+			Node root = _erase(_root, k, found);
+			if (!found)
+				return 0;
+			_replace(root);
+			--_size;
+			return 1;
+		}
+
+		void erase (const_iterator position) { erase(position->first); }
+
+		void swap (persistent_map& x) {
+			Node root = _root;
+			_root = x._root;
+			x._root = root;
+
+			size_type size = _size;
+			_size = x._size;
+			x._size = size;
+
+			Compare comp = _comp;
+			_comp = x._comp;
+			x._comp = comp;
+
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+
+			node_allocator_type node_alloc = _node_alloc;
+			_node_alloc = x._node_alloc;
+			x._node_alloc = node_alloc;
+		}
+
+		void clear() {
+			_replace(NULL);
+			_size = 0;
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return _comp; }
+		value_compare value_comp() const { return value_compare(_comp); }
+
+/** OPERATIONS:	***/
+		const_iterator find (const key_type& k) const {
+			const_iterator it = lower_bound(k);
+			if (it != end() && _comp(k, it->first))
+				return end();
+			return it;
+		}
+
+		size_type count (const key_type& k) const { return _find(k) != NULL; }
+
+	/** the path down to the key, cut at the last node not less than it */
+		const_iterator lower_bound (const key_type& k) const {
+			const_iterator it(_root);
+			int depth = 0;
+			for (Node node = _root; node; ) {
+				it.push(node);
+				if (_comp(node->_data.first, k))
+					node = node->_right;
+				else {
+					depth = it._depth;
+					node = node->_left;
+				}
+			}
+			it._depth = depth;
+			return it;
+		}
+
+		const_iterator upper_bound (const key_type& k) const {
+			const_iterator it(_root);
+			int depth = 0;
+			for (Node node = _root; node; ) {
+				it.push(node);
+				if (_comp(k, node->_data.first)) {
+					depth = it._depth;
+					node = node->_left;
+				}
+				else
+					node = node->_right;
+			}
+			it._depth = depth;
+			return it;
+		}
+
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+		static Node _retain(Node node) {
+			if (node)
+				ft::atomic_increment(&node->_refs);
+			return node;
+		}
+
+	/** drops a reference; the last one destroys the node and lets go of its children */
+		void _release(Node node) {
+			while (node && ft::atomic_decrement(&node->_refs) == 0) {
+				Node right = node->_right;
+				_release(node->_left);
+				_node_alloc.destroy(node);
+				_node_alloc.deallocate(node, 1);
+				node = right;
+			}
+		}
+
+	/** makes 'root' (already owned) the current version */
+		void _replace(Node root) {
+			Node old = _root;
+			_root = root;
+			_release(old);
+		}
+
+		Node _find(const key_type& k) const {
+			Node node = _root;
+			while (node) {
+				if (_comp(k, node->_data.first))
+					node = node->_left;
+				else if (_comp(node->_data.first, k))
+					node = node->_right;
+				else
+					return node;
+			}
+			return NULL;
+		}
+
+		Node _make(Node left, const value_type& val, Node right) {
+			Node node = _node_alloc.allocate(1);
+			try {
+				_node_alloc.construct(node, node_type(val, left, right));
+			}
+			catch (...) {
+				_node_alloc.deallocate(node, 1);
+				_release(left);
+				_release(right);
+				throw;
+			}
+			return node;
+		}
+
+	/** @brief New node for 'val' over the subtrees 'left' and 'right' (whose
+	 *	references it takes over), rotated if their heights differ by two.
+	 *	Rotating only builds new nodes: the old child lends its fields and is
+	 *	released, staying alive for the versions that still hold it. */
+		Node _balance(Node left, const value_type& val, Node right) {
+			int hl = node_type::height(left);
+			int hr = node_type::height(right);
+			if (hl > hr + 1) {
+				Node l = left;
+				Node node;
+				if (node_type::height(l->_left) >= node_type::height(l->_right))
+					node = _make(_retain(l->_left), l->_data, _make(_retain(l->_right), val, right));
+				else {
+					Node lr = l->_right;
+					node = _make(_make(_retain(l->_left), l->_data, _retain(lr->_left)), lr->_data,
+												_make(_retain(lr->_right), val, right));
+				}
+				_release(l);
+				return node;
+			}
+			if (hr > hl + 1) {
+				Node r = right;
+				Node node;
+				if (node_type::height(r->_right) >= node_type::height(r->_left))
+					node = _make(_make(left, val, _retain(r->_left)), r->_data, _retain(r->_right));
+				else {
+					Node rl = r->_left;
+					node = _make(_make(left, val, _retain(rl->_left)), rl->_data,
+												_make(_retain(rl->_right), r->_data, _retain(r->_right)));
+				}
+				_release(r);
+				return node;
+			}
+			return _make(left, val, right);
+		}
+
+	/** new version of the subtree 'node' holding 'val', or NULL if the key is
+	 *	already there and 'assign' is off (nothing was copied) */
+		Node _insert(Node node, const value_type& val, bool assign, bool& inserted) {
+			if (!node) {
+				inserted = true;
+				return _make(NULL, val, NULL);
+			}
+			if (_comp(val.first, node->_data.first)) {
+				Node left = _insert(node->_left, val, assign, inserted);
+				return left ? _balance(left, node->_data, _retain(node->_right)) : NULL;
+			}
+			if (_comp(node->_data.first, val.first)) {
+				Node right = _insert(node->_right, val, assign, inserted);
+				return right ? _balance(_retain(node->_left), node->_data, right) : NULL;
+			}
+			return assign ? _make(_retain(node->_left), val, _retain(node->_right)) : NULL;
+		}
+
+	/** new version of the subtree 'node' without 'k'; 'found' tells if there
+	 *	was one (else nothing was copied and NULL is returned) */
+		Node _erase(Node node, const key_type& k, bool& found) {
+			if (!node)
+				return NULL;
+			if (_comp(k, node->_data.first)) {
+				Node left = _erase(node->_left, k, found);
+				return found ? _balance(left, node->_data, _retain(node->_right)) : NULL;
+			}
+			if (_comp(node->_data.first, k)) {
+				Node right = _erase(node->_right, k, found);
+				return found ? _balance(_retain(node->_left), node->_data, right) : NULL;
+			}
+			found = true;
+			if (!node->_left)
+				return _retain(node->_right);
+			if (!node->_right)
+				return _retain(node->_left);
+			Node next = node->_right;
+			while (next->_left)
+				next = next->_left;
+			return _balance(_retain(node->_left), next->_data, _erase_min(node->_right));
+		}
+
+		Node _erase_min(Node node) {
+			if (!node->_left)
+				return _retain(node->_right);
+			return _balance(_erase_min(node->_left), node->_data, _retain(node->_right));
+		}
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator == (const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator != (const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator < (const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator <= (const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs) {
+		return !(rhs < lhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator > (const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs) {
+		return rhs < lhs; }
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator >= (const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs) {
+		return !(lhs < rhs); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (persistent_map<Key, T, Compare, Alloc>& lhs, persistent_map<Key, T, Compare, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,605 @@
+#ifndef _PREFIX_MAP_HPP_
+#define _PREFIX_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <new>
+#include "../inc/pair.hpp"
+#include "../inc/prefix_node.hpp"
+#include "../inc/prefix_iterator.hpp"
+#include "../inc/lex_compare.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+	/*----------------*/
+ /**	PREFIX:MAP:  */
+/*----------------*/
+
+/**	@brief Ordered map from strings on a compressed trie (Patricia): each
+ *	edge is labelled with the bytes its keys share (prefix_node), so a
+ *	prefix common to many keys, a "tenant/service/" path, is stored once
+ *	and the map holds no key whole. A lookup reads each key byte once on
+ *	the way down, comparing labels, with no string compare per level.
+ *	Keys are ordered by their bytes, as std::string compares them, and may
+ *	hold any byte. scan_prefix() gives the range of keys starting with a
+ *	string, found in one descent.
+ *	An iterator rebuilds its key as it moves (prefix_iterator): *it is a
+ *	{ first, second } proxy rather than a value_type&, whose first refers
+ *	to the iterator's key (a reverse iterator's holds a copy), and copying
+ *	an iterator copies a string. Insertion
+ *	invalidates no iterator; erasing a key may merge the last key left
+ *	under its branch into one node, which moves it, so erase invalidates
+ *	iterators. */
+template <class T,
+					class Alloc = std::allocator<ft::pair<const std::string, T> >
+> class prefix_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef std::string												key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const std::string, T>		value_type;
+		typedef std::less<std::string>						key_compare;
+
+/** @value_compare: compares the key of objects of type prefix_map::value_type	*/
+		class value_compare : public std::binary_function<value_type, value_type, bool> {
+			private:
+				friend class prefix_map;
+			protected:
+				key_compare comp;
+				value_compare (key_compare c) : comp(c) {}
+			public:
+				bool operator() (const value_type& lhs, const value_type& rhs) const {
+					return comp(lhs.first, rhs.first);
+				}
+		};
+
+		typedef Alloc																															allocator_type;
+		typedef ft::prefix_node<T>																								node_type;
+		typedef typename Alloc::template rebind<char>::other											byte_allocator_type;
+		typedef ft::prefix_iterator<T, node_type>																	iterator;
+		typedef ft::prefix_iterator<const T, node_type>														const_iterator;
+		typedef typename iterator::reference																			reference;
+		typedef typename const_iterator::reference																const_reference;
+		typedef typename iterator::pointer																				pointer;
+		typedef typename const_iterator::pointer																	const_pointer;
+		typedef ft::prefix_reverse_iterator<iterator>															reverse_iterator;
+		typedef ft::prefix_reverse_iterator<const_iterator>												const_reverse_iterator;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+		enum bound { lower, upper, past_prefix };
+
+		node_type*						_root;			// the empty key's node, valued if it is in
+		size_type							_size;
+		size_type							_memory;		// bytes in nodes and labels
+		allocator_type				_alloc;
+		byte_allocator_type		_bytes;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit prefix_map (const key_compare& = key_compare(),
+												const allocator_type& alloc = allocator_type()) :
+		_root(NULL), _size(0), _memory(0), _alloc(alloc), _bytes(alloc) {
+			_root = _new_node(NULL, 0, NULL);
+		}
+
+		template <class InputIterator>
+		prefix_map (InputIterator first, InputIterator last,
+								const key_compare& = key_compare(),
+								const allocator_type& alloc = allocator_type()) :
+		_root(NULL), _size(0), _memory(0), _alloc(alloc), _bytes(alloc) {
+			_root = _new_node(NULL, 0, NULL);
+			try {
+				insert(first, last);
+			}
+			catch (...) {
+				_destroy(_root);
+				throw;
+			}
+		}
+
+		prefix_map (const prefix_map& x) :
+		_root(NULL), _size(0), _memory(0), _alloc(x._alloc), _bytes(x._alloc) {
+			_root = _new_node(NULL, 0, NULL);
+			try {
+				insert(x.begin(), x.end());
+			}
+			catch (...) {
+				_destroy(_root);
+				throw;
+			}
+		}
+
+/**	DESTRUCTOR: 	*/
+		~prefix_map() { _destroy(_root); }
+
+		prefix_map& operator= (const prefix_map& x) {
+			if (this == &x) return *this;
+			clear();
+			insert(x.begin(), x.end());
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		iterator begin() { return _begin<iterator>(); }
+		const_iterator begin() const { return _begin<const_iterator>(); }
+		iterator end() { return iterator(NULL, &_root); }
+		const_iterator end() const { return const_iterator(NULL, &_root); }
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _size == 0; }
+		size_type size() const { return _size; }
+		size_type max_size() const { return _bytes.max_size() / node_type::bytes(1, true); }
+
+	/** bytes held by the nodes and their labels */
+		size_type memory() const { return _memory; }
+
+/** ELEMENT:ACCESS:	***/
+		mapped_type& operator[] (const key_type& k) {
+			node_type* node = _find(k);
+			if (node)
+				return node->value();
+			return (*(insert(ft::make_pair(k, mapped_type())).first)).second;
+		}
+
+		mapped_type& at (const key_type& k) {
+			node_type* node = _find(k);
+			if (!node) throw std::out_of_range("prefix_map::at: out of range");
+			return node->value();
+		}
+
+		const mapped_type& at (const key_type& k) const {
+			node_type* node = _find(k);
+			if (!node) throw std::out_of_range("prefix_map::at: out of range");
+			return node->value();
+		}
+
+/** MODIFIERS:	***/
+	/** @brief Follows the key down the labels and, where it parts from
+	 *	them, either adds a leaf to the node it reached, splits the label it
+	 *	disagreed with (or ended inside of) under a new node, or, when the
+	 *	key ends on a node, gives that node a value. No other key's node is
+	 *	moved. */
+		pair<iterator, bool> insert (const value_type& val) {
+			const key_type&	k = val.first;
+			const char*			key = k.data();
+			node_type*			node = _root;
+			size_type				depth = 0;
+
+			while (depth < k.size()) {
+				size_type i = node->index(key[depth]);
+				node_type* child = i < node->_count ? node->_children[i] : NULL;
+				if (!child || child->first() != static_cast<unsigned char>(key[depth])) {
+					node_type* leaf = _new_node(key + depth, k.size() - depth, &val.second);
+					try {
+						_add_child(node, i, leaf);
+					}
+					catch (...) {
+						_delete_node(leaf);
+						throw;
+					}
+					return _inserted(leaf, k);
+				}
+				size_type same = child->mismatch(key + depth, k.size() - depth);
+				if (same == child->_len) {
+					node = child;
+					depth += same;
+					continue;
+				}
+				bool ends = depth + same == k.size();
+				node_type* split = _new_node(key + depth, same, ends ? &val.second : NULL);
+				node_type* leaf = NULL;
+				try {
+					_grow(split);
+					if (!ends)
+						leaf = _new_node(key + depth + same, k.size() - depth - same, &val.second);
+				}
+				catch (...) {
+					_delete_node(split);
+					throw;
+				}
+				split->_parent = node;
+				node->_children[i] = split;
+				child->_skip += same;
+				child->_len -= same;
+				child->_parent = split;
+				split->insert_child(0, child);
+				if (!leaf)
+					return _inserted(split, k);
+				leaf->_parent = split;
+				split->insert_child(split->index(leaf->first()), leaf);
+				return _inserted(leaf, k);
+			}
+			if (node->_valued)
+				return ft::make_pair(iterator(node, &_root, k), false);
+			node_type* valued = _new_node(node->label(), node->_len, &val.second);
+			_replace(node, valued);
+			return _inserted(valued, k);
+		}
+
+		iterator insert (iterator, const value_type& val) { return insert(val).first; }
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		void erase (iterator position) {
+			if (position == end()) return;
+			_erase(position._node);
+		}
+
+		size_type erase (const key_type& k) {
+			node_type* node = _find(k);
+			if (!node)
+				return 0;
+			_erase(node);
+			return 1;
+		}
+
+	/** erasing may move the keys after 'first': their keys are read first */
+		void erase (iterator first, iterator last) {
+			ft::vector<key_type> keys;
+			for (; first != last; ++first)
+				keys.push_back(first->first);
+			for (typename ft::vector<key_type>::iterator k = keys.begin(); k != keys.end(); ++k)
+				erase(*k);
+		}
+
+		void swap (prefix_map& x) {
+			node_type* root = _root;
+			_root = x._root;
+			x._root = root;
+
+			size_type size = _size;
+			_size = x._size;
+			x._size = size;
+
+			size_type memory = _memory;
+			_memory = x._memory;
+			x._memory = memory;
+
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+
+			byte_allocator_type bytes = _bytes;
+			_bytes = x._bytes;
+			x._bytes = bytes;
+		}
+
+		void clear() {
+			node_type* root = _new_node(NULL, 0, NULL);
+			_destroy(_root);
+			_root = root;
+			_size = 0;
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return key_compare(); }
+		value_compare value_comp() const { return value_compare(key_compare()); }
+
+/** OPERATIONS:	***/
+		iterator find (const key_type& k) {
+			node_type* node = _find(k);
+			return node ? iterator(node, &_root, k) : end();
+		}
+		const_iterator find (const key_type& k) const {
+			node_type* node = _find(k);
+			return node ? const_iterator(node, &_root, k) : end();
+		}
+
+		size_type count (const key_type& k) const { return _find(k) != NULL; }
+
+		iterator lower_bound (const key_type& k) { return _bound<iterator>(k, lower); }
+		const_iterator lower_bound (const key_type& k) const { return _bound<const_iterator>(k, lower); }
+
+		iterator upper_bound (const key_type& k) { return _bound<iterator>(k, upper); }
+		const_iterator upper_bound (const key_type& k) const { return _bound<const_iterator>(k, upper); }
+
+		pair<iterator, iterator> equal_range (const key_type& k) {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			return ft::make_pair(lower_bound(k), upper_bound(k));
+		}
+
+	/** the keys starting with 'prefix', in order */
+		pair<iterator, iterator> scan_prefix (const key_type& prefix) {
+			return ft::make_pair(_bound<iterator>(prefix, lower), _bound<iterator>(prefix, past_prefix));
+		}
+		pair<const_iterator, const_iterator> scan_prefix (const key_type& prefix) const {
+			return ft::make_pair(_bound<const_iterator>(prefix, lower), _bound<const_iterator>(prefix, past_prefix));
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+	/** a node labelled with 'len' bytes from 'label', then 'more_len' from
+	 *	'more', holding a copy of '*value' if not NULL */
+		node_type* _new_node(const char* label, size_type len, const mapped_type* value,
+												const char* more = NULL, size_type more_len = 0) {
+			size_type bytes = node_type::bytes(len + more_len, value != NULL);
+			node_type* node = reinterpret_cast<node_type*>(_bytes.allocate(bytes));
+			if (value) {
+				try {
+					new (static_cast<void*>(&node->value())) mapped_type(*value);
+				}
+				catch (...) {
+					_bytes.deallocate(reinterpret_cast<char*>(node), bytes);
+					throw;
+				}
+			}
+			node->_parent = NULL;
+			node->_children = NULL;
+			node->_len = len + more_len;
+			node->_skip = 0;
+			node->_count = 0;
+			node->_capacity = 0;
+			node->_valued = value != NULL;
+			char* to = const_cast<char*>(node->label());
+			if (len)
+				std::memcpy(to, label, len);
+			if (more_len)
+				std::memcpy(to + len, more, more_len);
+			_memory += bytes;
+			return node;
+		}
+
+	/** deletes the node and its child array, not its children */
+		void _delete_node(node_type* node) {
+			size_type bytes = node->bytes();
+			if (node->_capacity)
+				_delete_array(node->_children, node->_capacity);
+			if (node->_valued)
+				node->value().~mapped_type();
+			_bytes.deallocate(reinterpret_cast<char*>(node), bytes);
+			_memory -= bytes;
+		}
+
+		void _delete_array(node_type** children, size_type capacity) {
+			_bytes.deallocate(reinterpret_cast<char*>(children), node_type::array_bytes(capacity));
+			_memory -= node_type::array_bytes(capacity);
+		}
+
+	/** deletes 'node' and every node below it */
+		void _destroy(node_type* node) {
+			for (size_type i = 0; i < node->_count; ++i)
+				_destroy(node->_children[i]);
+			_delete_node(node);
+		}
+
+	/** makes room for one more child: the array doubles, from 2 up to 256 */
+		void _grow(node_type* node) {
+			if (node->_count < node->_capacity)
+				return;
+			size_type capacity = node->_capacity ? node->_capacity * 2 : 2;
+			if (capacity > 256)
+				capacity = 256;
+			node_type** children = reinterpret_cast<node_type**>(_bytes.allocate(node_type::array_bytes(capacity)));
+			_memory += node_type::array_bytes(capacity);
+			unsigned char* keys = reinterpret_cast<unsigned char*>(children + capacity);
+			for (size_type i = 0; i < node->_count; ++i) {
+				children[i] = node->_children[i];
+				keys[i] = node->keys()[i];
+			}
+			if (node->_capacity)
+				_delete_array(node->_children, node->_capacity);
+			node->_children = children;
+			node->_capacity = capacity;
+		}
+
+		void _add_child(node_type* node, size_type i, node_type* child) {
+			_grow(node);
+			child->_parent = node;
+			node->insert_child(i, child);
+		}
+
+		pair<iterator, bool> _inserted(node_type* node, const key_type& k) {
+			++_size;
+			return ft::make_pair(iterator(node, &_root, k), true);
+		}
+
+	/** where 'node' is linked from: its parent's child array, or _root */
+		node_type** _link(node_type* node) {
+			if (!node->_parent)
+				return &_root;
+			return node->_parent->_children + node->_parent->index_of(node);
+		}
+
+	/** 'with' takes the children of 'node' */
+		void _take_children(node_type* with, node_type* node) {
+			with->_children = node->_children;
+			with->_count = node->_count;
+			with->_capacity = node->_capacity;
+			node->_children = NULL;
+			node->_count = 0;
+			node->_capacity = 0;
+			for (size_type i = 0; i < with->_count; ++i)
+				with->_children[i]->_parent = with;
+		}
+
+	/** puts 'with' in place of 'node', taking its children, and deletes it */
+		void _replace(node_type* node, node_type* with) {
+			with->_parent = node->_parent;
+			*_link(node) = with;
+			_take_children(with, node);
+			_delete_node(node);
+		}
+
+	/** @brief The key's node loses its value. A node without children goes,
+	 *	then its parent if left with one child and no value merges with that
+	 *	child, as the node does itself if it has one child: one node with
+	 *	the two labels joined replaces them. The merge allocates the new
+	 *	node first, so an exception leaves the map as it was. */
+		void _erase(node_type* node) {
+			node_type* parent = node->_parent;
+			if (!parent || node->_count > 1)
+				_replace(node, _new_node(node->label(), node->_len, NULL));
+			else if (node->_count)
+				_join(node);
+			else if (parent->_parent && !parent->_valued && parent->_count == 2) {
+				node_type* other = parent->_children[parent->_children[0] == node];
+				node_type* joined = _new_node(parent->label(), parent->_len, other->_valued ? &other->value() : NULL,
+																			other->label(), other->_len);
+				parent->remove_child(parent->index_of(node));
+				_delete_node(node);
+				_adopt(parent, other, joined);
+			}
+			else {
+				parent->remove_child(parent->index_of(node));
+				_delete_node(node);
+				if (!parent->_count) {
+					_delete_array(parent->_children, parent->_capacity);
+					parent->_children = NULL;
+					parent->_capacity = 0;
+				}
+			}
+			--_size;
+		}
+
+	/** merges 'node' with its only child */
+		void _join(node_type* node) {
+			node_type* child = node->_children[0];
+			_adopt(node, child, _new_node(node->label(), node->_len, child->_valued ? &child->value() : NULL,
+																		child->label(), child->_len));
+		}
+
+	/** puts 'joined' in place of 'node' and of its only child 'child' */
+		void _adopt(node_type* node, node_type* child, node_type* joined) {
+			joined->_parent = node->_parent;
+			*_link(node) = joined;
+			_take_children(joined, child);
+			_delete_node(child);
+			_delete_node(node);
+		}
+
+	/** the node of key 'k', if it is in */
+		node_type* _find(const key_type& k) const {
+			const char*	key = k.data();
+			node_type*	node = _root;
+			size_type		depth = 0;
+
+			while (depth < k.size()) {
+				node = node->find_child(key[depth]);
+				if (!node || node->mismatch(key + depth, k.size() - depth) != node->_len)
+					return NULL;
+				depth += node->_len;
+			}
+			return node->_valued ? node : NULL;
+		}
+
+		template <class It>
+		It _begin() const {
+			It it(_root, &_root);
+			if (!_size)
+				it._node = NULL;
+			else
+				it.first_below();
+			return it;
+		}
+
+	/** @brief The first key not below 'k' (lower), above it (upper), or not
+	 *	starting with it (past_prefix), in one descent: where the key parts
+	 *	from the labels, every key under the label it reached is on the same
+	 *	side of 'k', so the bound is the first of them or the first after. */
+		template <class It>
+		It _bound(const key_type& k, bound mode) const {
+			const char*	key = k.data();
+			It					it(_root, &_root);
+			size_type		depth = 0;
+
+			if (!_size)
+				return It(NULL, &_root);
+			while (depth < k.size()) {
+				unsigned char b = key[depth];
+				size_type i = it._node->index(b);
+				if (i == it._node->_count) {
+					it.skip();
+					return it;
+				}
+				node_type* child = it._node->_children[i];
+				it._node = child;
+				it._key.append(child->label(), child->_len);
+				if (child->first() > b) {
+					it.first_below();
+					return it;
+				}
+				size_type same = child->mismatch(key + depth, k.size() - depth);
+				if (same == child->_len) {
+					depth += same;
+					continue;
+				}
+				if (depth + same == k.size())
+					mode == past_prefix ? it.skip() : it.first_below();
+				else if (static_cast<unsigned char>(child->label()[same]) > static_cast<unsigned char>(key[depth + same]))
+					it.first_below();
+				else
+					it.skip();
+				return it;
+			}
+			if (mode == lower)
+				it.first_below();
+			else if (mode == upper && it._node->_valued)
+				++it;
+			else if (mode == upper)
+				it.first_below();
+			else
+				it.skip();
+			return it;
+		}
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+	template <class T, class Alloc>
+	bool operator == (const prefix_map<T, Alloc>& lhs, const prefix_map<T, Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+	template <class T, class Alloc>
+	bool operator != (const prefix_map<T, Alloc>& lhs, const prefix_map<T, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+	template <class T, class Alloc>
+	bool operator < (const prefix_map<T, Alloc>& lhs, const prefix_map<T, Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <class T, class Alloc>
+	bool operator <= (const prefix_map<T, Alloc>& lhs, const prefix_map<T, Alloc>& rhs) {
+		return !(rhs < lhs); }
+
+	template <class T, class Alloc>
+	bool operator > (const prefix_map<T, Alloc>& lhs, const prefix_map<T, Alloc>& rhs) {
+		return rhs < lhs; }
+
+	template <class T, class Alloc>
+	bool operator >= (const prefix_map<T, Alloc>& lhs, const prefix_map<T, Alloc>& rhs) {
+		return !(lhs < rhs); }
+
+	template <class T, class Alloc>
+	void swap (prefix_map<T, Alloc>& x, prefix_map<T, Alloc>& y) { x.swap(y); }
+}
+
+#endif
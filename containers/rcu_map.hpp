@@ -0,0 +1,170 @@
+#ifndef _RCU_MAP_HPP_
+#define _RCU_MAP_HPP_
+
+#include <sched.h>
+#include "map.hpp"
+#include "../inc/atomic.hpp"
+#include "../inc/epoch.hpp"
+#include "../inc/rwlock.hpp"
+
+namespace ft {
+
+	/*-------------*/
+ /**	RCU:MAP:  */
+/*-------------*/
+
+/**	@brief Read-mostly map (read-copy-update): the current version is an
+ *	immutable Map (an ft::map, a frozen_map...) behind an atomic pointer.
+ *	A reader enters the epoch domain and loads the pointer, then looks up
+ *	the plain Map with no lock and no write to shared memory: what a lookup
+ *	costs over an unsynchronised find is one fenced store and one load.
+ *	A writer builds the next version aside (update() copies the current one
+ *	and runs a functor on the copy, publish() takes a ready one), swaps it
+ *	in and retires the old one, freed once every reader that could see it
+ *	is gone; writers are serialised among themselves, never with readers.
+ *	Each publication moves the epoch on if it can, so a replaced version is
+ *	freed by a later publication once its readers are gone; synchronize()
+ *	waits until all are.
+ *	Meant for tables read all the time and changed now and then: a write
+ *	copies the whole map. */
+template <class Map = ft::map<int, int> >
+class rcu_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Map																map_type;
+		typedef typename Map::key_type						key_type;
+		typedef typename Map::mapped_type					mapped_type;
+		typedef typename Map::value_type					value_type;
+		typedef typename Map::key_compare					key_compare;
+		typedef typename Map::const_iterator			const_iterator;
+		typedef typename Map::size_type						size_type;
+
+	/** @brief The version current at construction, readable (and kept alive)
+	 *	until destruction, whatever is published meanwhile. Iterators into it
+	 *	are valid as long as the reader. */
+		class reader {
+
+			public:
+				explicit reader(const rcu_map& map) : _guard(map._epochs), _map(ft::atomic_load(&map._current)) {}
+
+				const map_type& operator*() const { return *_map; }
+				const map_type* operator->() const { return _map; }
+
+			private:
+				ft::epoch_guard		_guard;
+				const map_type*		_map;
+
+				reader(const reader&);
+				reader& operator= (const reader&);
+		};
+
+	private:
+		map_type* volatile				_current;
+		volatile long							_pending;		// versions retired, not yet freed
+		ft::rwlock								_writers;
+		mutable ft::epoch_domain	_epochs;
+
+		rcu_map(const rcu_map&);
+		rcu_map& operator= (const rcu_map&);
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		rcu_map() : _current(new map_type()), _pending(0) {}
+
+		explicit rcu_map(const map_type& map) : _current(new map_type(map)), _pending(0) {}
+
+/**	DESTRUCTOR: 	no thread may use the map any more */
+		~rcu_map() {
+			_epochs.reclaim_all();
+			delete _current;
+		}
+
+/** OPERATIONS:	***/
+	/** each of these reads the version current at the call */
+		size_type size() const {
+			reader r(*this);
+			return r->size();
+		}
+
+		bool empty() const {
+			reader r(*this);
+			return r->empty();
+		}
+
+		size_type count (const key_type& k) const {
+			reader r(*this);
+			return r->count(k);
+		}
+
+	/** copies the value of 'k' into 'out' if it is there */
+		bool get (const key_type& k, mapped_type& out) const {
+			reader r(*this);
+			const_iterator it = r->find(k);
+			if (it == r->end())
+				return false;
+			out = it->second;
+			return true;
+		}
+
+/** MODIFIERS:	***/
+	/** makes a copy of 'map' the current version */
+		void publish (const map_type& map) {
+			map_type* next = new map_type(map);
+			write_guard guard(_writers);
+			_replace(next);
+		}
+
+	/** calls f(map_type&) on a copy of the current version, then makes the
+	 *	copy current. If 'f' throws, nothing is published. 'f' must not use
+	 *	this rcu_map. */
+		template <class F>
+		void update (F f) {
+			write_guard guard(_writers);
+			map_type* next = new map_type(*_current);
+			try {
+				f(*next);
+			}
+			catch (...) {
+				delete next;
+				throw;
+			}
+			_replace(next);
+		}
+
+	/** waits until every version replaced so far is freed, so until the
+	 *	readers that could see one are gone. Not to be called by a thread
+	 *	holding a reader. */
+		void synchronize() {
+			while (ft::atomic_load(&_pending)) {
+				if (!_epochs.try_advance())
+					sched_yield();
+			}
+		}
+
+	private:
+	/** under the writers' lock */
+		void _replace(map_type* next) {
+			ft::epoch_guard guard(_epochs);
+			map_type* old = ft::atomic_exchange(&_current, next);
+			ft::atomic_increment(&_pending);
+			_epochs.retire(old, &_reclaim, this);
+			_epochs.try_advance();
+		}
+
+		static void _reclaim(void* self, void* map) {
+			delete static_cast<map_type*>(map);
+			ft::atomic_decrement(&static_cast<rcu_map*>(self)->_pending);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef _SHARDED_MAP_HPP_
+#define _SHARDED_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <new>
+#include "map.hpp"
+#include "../inc/pair.hpp"
+#include "../inc/hash.hpp"
+#include "../inc/rwlock.hpp"
+#include "../inc/merge_iterator.hpp"
+
+namespace ft {
+
+	/*-----------------*/
+ /**	SHARDED:MAP:  */
+/*-----------------*/
+
+/**	@brief Ordered map to share between threads. Keys are spread by hash
+ *	over Shards independent ft::maps, each behind its own reader-writer
+ *	lock, so threads working on different shards never wait on each other
+ *	and lookups in the same shard only wait on its writers.
+ *	Single-key operations lock one shard for the duration of the call and
+ *	hand out copies: an iterator into a shard would outlive its lock.
+ *	update() runs a functor on an element under its shard's write lock.
+ *	In-order access goes through an ordered_view, which read-locks every
+ *	shard (always in index order, so views cannot deadlock) and merges the
+ *	shards on the fly. size() adds up the shards one lock at a time: exact
+ *	only when no one writes. Hashing keeps the shards even whatever the key
+ *	distribution, where range splits would need rebalancing. */
+template <class Key,
+					class T,
+					class Compare = std::less<Key>,
+					std::size_t Shards = 16,
+					class Hash = ft::hash<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class sharded_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																							key_type;
+		typedef T																								mapped_type;
+		typedef ft::pair<const Key, T>													value_type;
+		typedef Compare																					key_compare;
+		typedef Hash																						hasher;
+		typedef Alloc																						allocator_type;
+		typedef ft::map<Key, T, Compare, Alloc>									shard_type;
+		typedef typename shard_type::const_iterator							shard_iterator;
+		typedef ft::merge_iterator<shard_iterator, Compare, Shards>	const_iterator;
+		typedef std::size_t																			size_type;
+
+		static const size_type	shard_count = Shards;
+
+	private:
+	/** a cache line apart from the next one, so that two threads taking the
+	 *	locks of neighbouring shards do not bounce the same line */
+		struct shard {
+			mutable rwlock	lock;
+			shard_type			map;
+			char						pad[64];
+
+			shard(const Compare& comp, const Alloc& alloc) : map(comp, alloc) {}
+		};
+
+		shard*		_shards;
+		Compare		_comp;
+		Hash			_hash;
+		Alloc			_alloc;
+
+		sharded_map(const sharded_map&);
+		sharded_map& operator= (const sharded_map&);
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+		explicit sharded_map (const key_compare& comp = key_compare(),
+													const hasher& hash = hasher(),
+													const allocator_type& alloc = allocator_type()) :
+		_shards(static_cast<shard*>(::operator new(Shards * sizeof(shard)))), _comp(comp), _hash(hash), _alloc(alloc) {
+			size_type i = 0;
+			try {
+				for (; i < Shards; ++i)
+					new (&_shards[i]) shard(comp, alloc);
+			}
+			catch (...) {
+				_destroy(i);
+				throw;
+			}
+		}
+
+/**	DESTRUCTOR: 	*/
+		~sharded_map() { _destroy(Shards); }
+
+/** CAPACITY:	***/
+		bool empty() const { return size() == 0; }
+
+		size_type size() const {
+			size_type n = 0;
+			for (size_type i = 0; i < Shards; ++i) {
+				read_guard guard(_shards[i].lock);
+				n += _shards[i].map.size();
+			}
+			return n;
+		}
+
+/** MODIFIERS:	***/
+	/** @return whether 'val' went in (false: the key was there) */
+		bool insert (const value_type& val) {
+			shard& s = _shard(val.first);
+			write_guard guard(s.lock);
+			return s.map.insert(val).second;
+		}
+
+	/** @return whether the key is new (false: its value was replaced) */
+		bool insert_or_assign (const key_type& k, const mapped_type& obj) {
+			shard& s = _shard(k);
+			write_guard guard(s.lock);
+			ft::pair<typename shard_type::iterator, bool> res = s.map.insert(value_type(k, obj));
+			if (!res.second)
+				res.first->second = obj;
+			return res.second;
+		}
+
+		size_type erase (const key_type& k) {
+			shard& s = _shard(k);
+			write_guard guard(s.lock);
+			return s.map.erase(k);
+		}
+
+	/** calls f(mapped_type&) on the element of key 'k', under its shard's
+	 *	write lock, and tells whether there was one. 'f' must not use the map. */
+		template <class F>
+		bool update (const key_type& k, F f) {
+			shard& s = _shard(k);
+			write_guard guard(s.lock);
+			typename shard_type::iterator it = s.map.find(k);
+			if (it == s.map.end())
+				return false;
+			f(it->second);
+			return true;
+		}
+
+		void clear() {
+			for (size_type i = 0; i < Shards; ++i) {
+				write_guard guard(_shards[i].lock);
+				_shards[i].map.clear();
+			}
+		}
+
+/** OBSERVERS:	***/
+		key_compare key_comp() const { return _comp; }
+		hasher hash_function() const { return _hash; }
+
+	/** the shard holding 'k' */
+		size_type shard_of (const key_type& k) const { return _hash(k) % Shards; }
+
+/** OPERATIONS:	***/
+	/** copies the value of 'k' into 'out' if it is there */
+		bool get (const key_type& k, mapped_type& out) const {
+			const shard& s = _shard(k);
+			read_guard guard(s.lock);
+			shard_iterator it = s.map.find(k);
+			if (it == s.map.end())
+				return false;
+			out = it->second;
+			return true;
+		}
+
+		size_type count (const key_type& k) const {
+			const shard& s = _shard(k);
+			read_guard guard(s.lock);
+			return s.map.count(k);
+		}
+
+	/** @brief The whole map in key order, read-locked from construction to
+	 *	destruction: writers wait until the view is gone, other readers and
+	 *	views do not. Not to be built by a thread in the middle of a write. */
+		class ordered_view {
+
+			public:
+				explicit ordered_view(const sharded_map& map) : _map(map) {
+					for (size_type i = 0; i < Shards; ++i)
+						_map._shards[i].lock.lock_shared();
+				}
+
+				~ordered_view() {
+					for (size_type i = Shards; i-- > 0; )
+						_map._shards[i].lock.unlock_shared();
+				}
+
+				const_iterator begin() const {
+					const_iterator it(_map._comp);
+					for (size_type i = 0; i < Shards; ++i)
+						it.set(i, _map._shards[i].map.begin(), _map._shards[i].map.end());
+					it.select();
+					return it;
+				}
+
+				const_iterator end() const { return const_iterator(_map._comp); }
+
+			/** first element whose key is not less than 'k' */
+				const_iterator lower_bound(const key_type& k) const {
+					const_iterator it(_map._comp);
+					for (size_type i = 0; i < Shards; ++i)
+						it.set(i, _map._shards[i].map.lower_bound(k), _map._shards[i].map.end());
+					it.select();
+					return it;
+				}
+
+			private:
+				const sharded_map&	_map;
+
+				ordered_view(const ordered_view&);
+				ordered_view& operator= (const ordered_view&);
+		};
+
+	/** calls f(const value_type&) on every element in key order, in an ordered_view */
+		template <class F>
+		void for_each (F f) const {
+			ordered_view view(*this);
+			for (const_iterator it = view.begin(); it != view.end(); ++it)
+				f(*it);
+		}
+
+/** ALLOCATOR:	***/
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+		shard& _shard(const key_type& k) { return _shards[shard_of(k)]; }
+		const shard& _shard(const key_type& k) const { return _shards[shard_of(k)]; }
+
+		void _destroy(size_type built) {
+			while (built-- > 0)
+				_shards[built].~shard();
+			::operator delete(_shards);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef _UNORDERED_MAP_HPP_
+#define _UNORDERED_MAP_HPP_
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "../inc/pair.hpp"
+#include "../inc/hash.hpp"
+#include "../inc/hash_table.hpp"
+
+namespace ft {
+
+	/*--------------------*/
+ /**	UNORDERED:MAP:   */
+/*--------------------*/
+
+/**	@brief Hash map for tables that only see point lookups: same interface as
+ *	ft::map minus the ordered operations, and an average O(1) find that reads
+ *	a 16-byte group of control bytes and, nearly always, one element.
+ *	Elements are stored in place in an open-addressing ft::hash_table (see
+ *	there for the probing and growth rules): an insert that makes the table
+ *	grow invalidates iterators, references and pointers to elements;
+ *	erase only invalidates the erased one. Iteration order is unspecified. */
+template <class Key,
+					class T,
+					class Hash = ft::hash<Key>,
+					class Pred = std::equal_to<Key>,
+					class Alloc = std::allocator<ft::pair<const Key, T> >
+> class unordered_map {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef T																	mapped_type;
+		typedef ft::pair<const Key, T>						value_type;
+		typedef Hash															hasher;
+		typedef Pred															key_equal;
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::reference																					reference;
+		typedef typename Alloc::const_reference																		const_reference;
+		typedef typename Alloc::pointer																						pointer;
+		typedef typename Alloc::const_pointer																			const_pointer;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+		struct key_of_value {
+			const Key& operator() (const value_type& val) const { return val.first; }
+		};
+
+	public:
+		typedef ft::hash_table<value_type, Key, key_of_value, Hash, Pred, Alloc>		table_type;
+		typedef typename table_type::iterator																			iterator;
+		typedef typename table_type::const_iterator																const_iterator;
+
+	private:
+		table_type	_table;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+	/** 'n': elements to make room for */
+		explicit unordered_map (size_type n = 0,
+														const hasher& hf = hasher(),
+														const key_equal& eql = key_equal(),
+														const allocator_type& alloc = allocator_type()) :
+		_table(n, hf, eql, alloc) {}
+
+		template <class InputIterator>
+		unordered_map (InputIterator first, InputIterator last,
+									size_type n = 0,
+									const hasher& hf = hasher(),
+									const key_equal& eql = key_equal(),
+									const allocator_type& alloc = allocator_type()) :
+		_table(n, hf, eql, alloc) {
+			insert(first, last);
+		}
+
+		unordered_map (const unordered_map& x) : _table(x._table) {}
+
+/**	DESTRUCTOR: 	*/
+		~unordered_map() {}
+
+		unordered_map& operator= (const unordered_map& x) {
+			_table = x._table;
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		iterator begin() { return _table.begin(); }
+		const_iterator begin() const { return _table.begin(); }
+		iterator end() { return _table.end(); }
+		const_iterator end() const { return _table.end(); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _table.empty(); }
+		size_type size() const { return _table.size(); }
+		size_type max_size() const { return _table.max_size(); }
+
+/** ELEMENT:ACCESS:	***/
+	/** one probe: the element is only built when the key is missing */
+		mapped_type& operator[] (const key_type& k) {
+			std::size_t										h = _table.hash(k);
+			ft::pair<size_type, bool>	r = _table.find_or_prepare(k, h);
+			if (!r.second)
+				_table.construct(r.first, h, value_type(k, mapped_type()));
+			return _table.slot(r.first).second;
+		}
+
+		mapped_type& at (const key_type& k) {
+			iterator it = find(k);
+			if (it == end()) throw std::out_of_range("unordered_map::at: out of range");
+			return it->second;
+		}
+
+		const mapped_type& at (const key_type& k) const {
+			const_iterator it = find(k);
+			if (it == end()) throw std::out_of_range("unordered_map::at: out of range");
+			return it->second;
+		}
+
+/** MODIFIERS:	***/
+		pair<iterator, bool> insert (const value_type& val) {
+			ft::pair<size_type, bool> r = _table.insert(val);
+			return ft::make_pair(_table.at_index(r.first), r.second);
+		}
+
+		iterator insert (const_iterator, const value_type& val) { return insert(val).first; }
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				_table.insert(*first);
+		}
+
+		void erase (const_iterator position) { _table.erase(_table.index_of(position)); }
+
+		size_type erase (const key_type& k) {
+			size_type i = _table.find(k);
+			if (i == _table.capacity()) return 0;
+			_table.erase(i);
+			return 1;
+		}
+
+		void erase (const_iterator first, const_iterator last) {
+			while (first != last)
+				erase(first++);
+		}
+
+		void clear() { _table.clear(); }
+
+		void swap (unordered_map& x) { _table.swap(x._table); }
+
+/** LOOKUP:	***/
+		iterator find (const key_type& k) { return _table.at_index(_table.find(k)); }
+		const_iterator find (const key_type& k) const { return _table.at_index(_table.find(k)); }
+
+		size_type count (const key_type& k) const { return _table.find(k) != _table.capacity(); }
+
+		pair<iterator, iterator> equal_range (const key_type& k) {
+			iterator it = find(k);
+			if (it == end())
+				return ft::make_pair(it, it);
+			iterator next = it;
+			return ft::make_pair(it, ++next);
+		}
+		pair<const_iterator, const_iterator> equal_range (const key_type& k) const {
+			const_iterator it = find(k);
+			if (it == end())
+				return ft::make_pair(it, it);
+			const_iterator next = it;
+			return ft::make_pair(it, ++next);
+		}
+
+/** BUCKETS:	***/
+	/** every slot is a bucket of one */
+		size_type bucket_count() const { return _table.capacity(); }
+		float load_factor() const { return _table.load_factor(); }
+		float max_load_factor() const { return _table.max_load_factor(); }
+
+	/** rebuilds for 'n' elements, dropping the tombstones of erased ones */
+		void rehash (size_type n) { _table.rehash(n); }
+
+	/** room for 'n' elements without a rebuild */
+		void reserve (size_type n) { _table.reserve(n); }
+
+/** OBSERVERS:	***/
+		hasher hash_function() const { return _table.hash_function(); }
+		key_equal key_eq() const { return _table.key_eq(); }
+		allocator_type get_allocator() const { return _table.get_allocator(); }
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+/** same elements, whatever their order */
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	bool operator == (const unordered_map<Key, T, Hash, Pred, Alloc>& lhs, const unordered_map<Key, T, Hash, Pred, Alloc>& rhs) {
+		if (lhs.size() != rhs.size())
+			return false;
+		typedef typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator	const_iterator;
+		for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+			const_iterator other = rhs.find(it->first);
+			if (other == rhs.end() || !(other->second == it->second))
+				return false;
+		}
+		return true;
+	}
+
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	bool operator != (const unordered_map<Key, T, Hash, Pred, Alloc>& lhs, const unordered_map<Key, T, Hash, Pred, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	void swap (unordered_map<Key, T, Hash, Pred, Alloc>& lhs, unordered_map<Key, T, Hash, Pred, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef _UNORDERED_SET_HPP_
+#define _UNORDERED_SET_HPP_
+
+#include <memory>
+#include <functional>
+#include "../inc/pair.hpp"
+#include "../inc/hash.hpp"
+#include "../inc/hash_table.hpp"
+
+namespace ft {
+
+	/*--------------------*/
+ /**	UNORDERED:SET:   */
+/*--------------------*/
+
+/**	@brief Hash set on the same open-addressing ft::hash_table as
+ *	ft::unordered_map, with the same invalidation rules. Elements are their
+ *	own keys, so both iterator types only give const access. */
+template <class Key,
+					class Hash = ft::hash<Key>,
+					class Pred = std::equal_to<Key>,
+					class Alloc = std::allocator<Key>
+> class unordered_set {
+
+	public:
+
+	/*-----------------*/
+ /**	MEMBER:TYPES: */
+/*-----------------*/
+
+		typedef Key																key_type;
+		typedef Key																value_type;
+		typedef Hash															hasher;
+		typedef Pred															key_equal;
+
+		typedef Alloc																															allocator_type;
+		typedef typename Alloc::reference																					reference;
+		typedef typename Alloc::const_reference																		const_reference;
+		typedef typename Alloc::pointer																						pointer;
+		typedef typename Alloc::const_pointer																			const_pointer;
+		typedef std::ptrdiff_t																										difference_type;
+		typedef std::size_t																												size_type;
+
+	private:
+		struct key_of_value {
+			const Key& operator() (const value_type& val) const { return val; }
+		};
+
+	public:
+		typedef ft::hash_table<value_type, Key, key_of_value, Hash, Pred, Alloc>		table_type;
+		typedef typename table_type::const_iterator																iterator;
+		typedef typename table_type::const_iterator																const_iterator;
+
+	private:
+		table_type	_table;
+
+	public:
+ 	/*---------------------*/
+ /**	MEMBER:FUNCTIONS: */
+/*---------------------*/
+
+/**	CONSTRUCTOR: 	*/
+	/** 'n': elements to make room for */
+		explicit unordered_set (size_type n = 0,
+														const hasher& hf = hasher(),
+														const key_equal& eql = key_equal(),
+														const allocator_type& alloc = allocator_type()) :
+		_table(n, hf, eql, alloc) {}
+
+		template <class InputIterator>
+		unordered_set (InputIterator first, InputIterator last,
+									size_type n = 0,
+									const hasher& hf = hasher(),
+									const key_equal& eql = key_equal(),
+									const allocator_type& alloc = allocator_type()) :
+		_table(n, hf, eql, alloc) {
+			insert(first, last);
+		}
+
+		unordered_set (const unordered_set& x) : _table(x._table) {}
+
+/**	DESTRUCTOR: 	*/
+		~unordered_set() {}
+
+		unordered_set& operator= (const unordered_set& x) {
+			_table = x._table;
+			return *this;
+		}
+
+/** ITERATORS:	***/
+		iterator begin() const { return _table.begin(); }
+		iterator end() const { return _table.end(); }
+
+/** CAPACITY:	***/
+		bool empty() const { return _table.empty(); }
+		size_type size() const { return _table.size(); }
+		size_type max_size() const { return _table.max_size(); }
+
+/** MODIFIERS:	***/
+		pair<iterator, bool> insert (const value_type& val) {
+			ft::pair<size_type, bool> r = _table.insert(val);
+			return ft::make_pair(iterator(_table.at_index(r.first)), r.second);
+		}
+
+		iterator insert (const_iterator, const value_type& val) { return insert(val).first; }
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				_table.insert(*first);
+		}
+
+		void erase (const_iterator position) { _table.erase(_table.index_of(position)); }
+
+		size_type erase (const key_type& k) {
+			size_type i = _table.find(k);
+			if (i == _table.capacity()) return 0;
+			_table.erase(i);
+			return 1;
+		}
+
+		void erase (const_iterator first, const_iterator last) {
+			while (first != last)
+				erase(first++);
+		}
+
+		void clear() { _table.clear(); }
+
+		void swap (unordered_set& x) { _table.swap(x._table); }
+
+/** LOOKUP:	***/
+		iterator find (const key_type& k) const { return _table.at_index(_table.find(k)); }
+
+		size_type count (const key_type& k) const { return _table.find(k) != _table.capacity(); }
+
+		pair<iterator, iterator> equal_range (const key_type& k) const {
+			iterator it = find(k);
+			if (it == end())
+				return ft::make_pair(it, it);
+			iterator next = it;
+			return ft::make_pair(it, ++next);
+		}
+
+/** BUCKETS:	***/
+	/** every slot is a bucket of one */
+		size_type bucket_count() const { return _table.capacity(); }
+		float load_factor() const { return _table.load_factor(); }
+		float max_load_factor() const { return _table.max_load_factor(); }
+
+	/** rebuilds for 'n' elements, dropping the tombstones of erased ones */
+		void rehash (size_type n) { _table.rehash(n); }
+
+	/** room for 'n' elements without a rebuild */
+		void reserve (size_type n) { _table.reserve(n); }
+
+/** OBSERVERS:	***/
+		hasher hash_function() const { return _table.hash_function(); }
+		key_equal key_eq() const { return _table.key_eq(); }
+		allocator_type get_allocator() const { return _table.get_allocator(); }
+	};
+
+	/*-----------------------------------*/
+ /**	NON:MEMBER:FUNCTION:OVERLOADS:	*/
+/*-----------------------------------*/
+
+/** same elements, whatever their order */
+	template <class Key, class Hash, class Pred, class Alloc>
+	bool operator == (const unordered_set<Key, Hash, Pred, Alloc>& lhs, const unordered_set<Key, Hash, Pred, Alloc>& rhs) {
+		if (lhs.size() != rhs.size())
+			return false;
+		typedef typename unordered_set<Key, Hash, Pred, Alloc>::const_iterator	const_iterator;
+		for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+			if (rhs.count(*it) == 0)
+				return false;
+		return true;
+	}
+
+	template <class Key, class Hash, class Pred, class Alloc>
+	bool operator != (const unordered_set<Key, Hash, Pred, Alloc>& lhs, const unordered_set<Key, Hash, Pred, Alloc>& rhs) {
+		return !(lhs == rhs); }
+
+	template <class Key, class Hash, class Pred, class Alloc>
+	void swap (unordered_set<Key, Hash, Pred, Alloc>& lhs, unordered_set<Key, Hash, Pred, Alloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
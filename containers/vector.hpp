@@ -114,10 +114,10 @@ namespace ft {
  *	@details Memory is allocated equal to the capacity of the original vector
  *	Elements of the original vector are copied to the new allocated space */ 
 		vector (const vector& other) :
-		_allocator(other._allocator), _data(other._data), _finish(other._finish), _capacity(other._capacity)
+		_allocator(other._allocator), _data(NULL), _finish(NULL), _capacity(NULL)
 		{
 			size_type n = other._capacity - other._data;
-			if (other.size() > 0) {
+			if (n > 0) {
 				_data = _allocator.allocate(other.capacity());
 				_finish = uninitialized_copy(other.begin(), other.end(), _data);
 				_capacity = _data + n;
@@ -126,7 +126,11 @@ namespace ft {
 
 /**	DESTRUCTOR: 	*/
 //	(destructor)	Vector destructor
-		virtual ~vector() {}
+		virtual ~vector() {
+			clear();
+			if (_data)
+				_allocator.deallocate(_data, capacity());
+		}
 
 /**	OPERATOR:(=) 	*/
 		vector& operator= (const vector& other) {
@@ -182,7 +186,8 @@ namespace ft {
 		
 		void reserve(size_type n) {	// reservers storage if capacity is less than new_cap
 			if (n >= capacity()) {
-				pointer start = _allocator.allocate(new_capacity(n)); 
+				size_type len = new_capacity(n);
+				pointer start = _allocator.allocate(len); 
 				pointer finish = start;
 		//	copy from start of old vec to position
 				try {
@@ -190,7 +195,7 @@ namespace ft {
 				}
 		//	If an error occurrs destroy the new allocated vector
 				catch(...) {
-					erase(start, finish);
+					discard(start, finish, len);
 					throw;
 				}
 		//	Destroy old vector data
@@ -221,9 +226,9 @@ namespace ft {
 
 		const_reference back() const { return *(end() - 1); }
 
-		value_type* data() { return begin(); }
+		value_type* data() { return _data; }
 
-		const value_type* data() const { begin(); }
+		const value_type* data() const { return _data; }
 
 /** MODIFIERS: */
 /** @assign:	Assigns new contents to the vector replacing its current contents
@@ -266,7 +271,7 @@ namespace ft {
 
 		// pop_back:			Delete last element
 		void pop_back() {
-			_allocator.destroy(_data - 1);
+			_allocator.destroy(_finish - 1);
 			_finish--;
 		}
 
@@ -274,6 +279,15 @@ namespace ft {
 		iterator insert (iterator position, const value_type& val) {
 			size_type n = position - begin();
 			if (position == end()) push_back(val);
+		//	room left: shift the tail up by one in place
+			else if (_finish != _capacity) {
+				value_type copy(val);
+				_allocator.construct(_finish, *(_finish - 1));
+				for (pointer p = _finish - 1; p != position.base(); --p)
+					*p = *(p - 1);
+				*position = copy;
+				++_finish;
+			}
 			else {
 				size_type len = new_capacity(size());
 				pointer start = _allocator.allocate(len);
@@ -284,7 +298,7 @@ namespace ft {
 					finish = uninitialized_copy(position, end(), finish);	
 				}
 				catch(...) {
-					erase(start, finish);
+					discard(start, finish, len);
 					throw;
 				}
 				reallocate(start, finish, len);
@@ -300,7 +314,8 @@ namespace ft {
 			if (len <= capacity() && position == end())
 				while (n--) insert(position, val);
 			else {
-				pointer start = _allocator.allocate(new_capacity(len));
+				size_type cap = new_capacity(len);
+				pointer start = _allocator.allocate(cap);
 				pointer finish = start;
 //			If the allocation fails, the content allocated must be erased and a bad_alloc thrown 				
 				try {
@@ -310,7 +325,7 @@ namespace ft {
 					finish = uninitialized_copy(position, end(), finish);
 				}
 				catch(...) {
-					erase(start, finish);
+					discard(start, finish, cap);
 					throw;
 				}
 				reallocate(start, finish, len);
@@ -328,7 +343,8 @@ namespace ft {
 					insert(position, *first);
 			}
 			else {
-				pointer start = _allocator.allocate(new_capacity(len)); 
+				size_type cap = new_capacity(len);
+				pointer start = _allocator.allocate(cap); 
 				pointer finish = start;
 				try {
 					finish = uninitialized_copy(begin(), position, start);
@@ -337,7 +353,7 @@ namespace ft {
 					finish = uninitialized_copy(position, end(), finish);
 				}
 				catch(...) {
-					erase(start, finish);
+					discard(start, finish, cap);
 					throw;
 				}
 				reallocate(start, finish, len);
@@ -346,12 +362,13 @@ namespace ft {
 	
 	/** @brief:
 	 * If the position given is not the last element of the vector
-	 * we copy all the elements from position to the last element
+	 * the elements after it are assigned one place down
 	 * The size (_finish iterator) is reduced and the last element is deleted
 	 * Position is returned as the element after the one it was erased	*/
 		iterator erase (iterator position) {
-			uninitialized_copy(position + 1, end(), position);
-			_finish--;
+			for (iterator it = position; it + 1 != end(); ++it)
+				*it = *(it + 1);
+			_allocator.destroy(--_finish);
 			return position;
 		}
 
@@ -364,12 +381,12 @@ namespace ft {
 	 * and the last element are destroyed, since they were already copied
 	 * The last element in the vector is returned	*/ 
 		iterator erase (iterator first, iterator last) {
-			iterator ret = first;
-			if (last != end())
-				uninitialized_copy(last, end(), first);
-			while (first++ != last)
-				_allocator.destroy(_finish--); 
-			return ret;
+			iterator it = first;
+			for (iterator from = last; from != end(); ++from, ++it)
+				*it = *from;
+			while (_finish != it.base())
+				_allocator.destroy(--_finish);
+			return first;
 		};
 
 		void swap (vector& other) {
@@ -405,6 +422,13 @@ namespace ft {
 			return cap;
 		}
 
+	//	drops a new buffer that failed to fill: what was built, then the memory
+		void discard(pointer start, pointer finish, size_type len) {
+			while (finish != start)
+				_allocator.destroy(--finish);
+			_allocator.deallocate(start, len);
+		}
+
 		void reallocate(pointer start, pointer finish, size_type len) {
 			clear();			
 			_allocator.deallocate(_data, capacity());
@@ -0,0 +1,183 @@
+#ifndef _ARENA_ALLOCATOR_HPP_
+#define _ARENA_ALLOCATOR_HPP_
+
+#include <memory>
+#include <new>
+#include <cstddef>
+#include "enable_if.hpp"
+#include "node_pool_allocator.hpp"
+
+namespace ft {
+
+	/*-----------------*/
+ /**	ARENA:REGION: */
+/*-----------------*/
+
+/**	@brief The memory behind every arena_allocator sharing it, whatever their
+ *	type: a list of chunks and a bump cursor into the newest one.
+ *	Chunks double from min_chunk bytes up to max_chunk bytes
+ *	(bigger requests get a chunk of their own size) */
+	struct arena_region {
+
+		static const std::size_t	min_chunk = 4096;
+		static const std::size_t	max_chunk = 1 << 20;
+
+		struct chunk {
+			chunk*	next;
+		};
+
+		union max_align {
+			long double	align_ld;
+			long long		align_ll;
+			void*				align_ptr;
+		};
+
+		std::size_t		refs;
+		char*					cursor;
+		char*					limit;
+		chunk*				chunks;
+		std::size_t		next_size;
+
+		explicit arena_region(std::size_t initial) :
+		refs(1), cursor(NULL), limit(NULL), chunks(NULL),
+		next_size(initial < min_chunk ? std::size_t(min_chunk) : initial) {}
+
+		~arena_region() {
+			while (chunks) {
+				chunk* next = chunks->next;
+				::operator delete(chunks);
+				chunks = next;
+			}
+		}
+
+		// chunk memory starts after its header, on the strictest alignment
+		static std::size_t chunk_offset() {
+			return ((sizeof(chunk) + sizeof(max_align) - 1) / sizeof(max_align)) * sizeof(max_align);
+		}
+
+		void add_chunk(std::size_t bytes) {
+			std::size_t size = next_size;
+			if (size < bytes)
+				size = bytes;
+			else if (next_size < max_chunk)
+				next_size *= 2;
+			chunk* c = static_cast<chunk*>(::operator new(chunk_offset() + size));
+			c->next = chunks;
+			chunks = c;
+			cursor = reinterpret_cast<char*>(c) + chunk_offset();
+			limit = cursor + size;
+		}
+
+		// room for 'bytes' at 'align' in the current chunk, or a new chunk
+		void* bump(std::size_t bytes, std::size_t align) {
+			std::size_t pad = (align - reinterpret_cast<std::size_t>(cursor) % align) % align;
+			if (cursor == NULL || std::size_t(limit - cursor) < pad + bytes) {
+				add_chunk(bytes);
+				pad = 0;
+			}
+			void* p = cursor + pad;
+			cursor += pad + bytes;
+			return p;
+		}
+
+		void reserve(std::size_t bytes) {
+			if (cursor == NULL || std::size_t(limit - cursor) < bytes)
+				add_chunk(bytes);
+		}
+
+	private:
+		arena_region(const arena_region&);
+		arena_region& operator=(const arena_region&);
+	};
+
+	/*--------------------*/
+ /**	ARENA:ALLOCATOR: */
+/*--------------------*/
+
+/**	@brief Monotonic allocator: objects are bumped out of big chunks and
+ *	deallocate() does nothing; the whole region goes back at once when the
+ *	last allocator sharing it is destroyed.
+ *	Copies and rebinds share the region, so several containers built for one
+ *	request can draw from a single arena and be dropped together.
+ *	A map on an arena with trivially destructible elements does not even walk
+ *	its nodes on clear() or destruction (see pool_traits::bulk_release):
+ *	teardown is the release of a handful of chunks.
+ *	Memory of erased elements is only reclaimed with the region.
+ *	Not thread safe. */
+	template <class T>
+	class arena_allocator {
+
+	public:
+		typedef T									value_type;
+		typedef T*								pointer;
+		typedef const T*					const_pointer;
+		typedef T&								reference;
+		typedef const T&					const_reference;
+		typedef std::size_t				size_type;
+		typedef std::ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind { typedef arena_allocator<U> other; };
+
+	private:
+		arena_region*	_region;
+
+		void release() {
+			if (--_region->refs == 0)
+				delete _region;
+		}
+
+		template <class U> friend class arena_allocator;
+
+	public:
+/**	CONSTRUCTOR: 	*/
+		// 'initial' bytes for the first chunk: size it for the whole request
+		explicit arena_allocator(size_type initial = arena_region::min_chunk) : _region(new arena_region(initial)) {}
+
+		arena_allocator(const arena_allocator& other) : _region(other._region) { ++_region->refs; }
+
+		template <class U>
+		arena_allocator(const arena_allocator<U>& other) : _region(other._region) { ++_region->refs; }
+
+		~arena_allocator() { release(); }
+
+		arena_allocator& operator= (const arena_allocator& other) {
+			if (_region == other._region) return *this;
+			++other._region->refs;
+			release();
+			_region = other._region;
+			return *this;
+		}
+
+/**	ALLOCATION: 	*/
+		pointer allocate(size_type n, const void* = 0) {
+			return static_cast<pointer>(_region->bump(n * sizeof(T), ft::alignment_of<T>::value));
+		}
+
+		// monotonic: the memory comes back with the region
+		void deallocate(pointer, size_type) {}
+
+	/** makes room for 'n' more objects in the current chunk */
+		void reserve(size_type n) { _region->reserve(n * sizeof(T) + ft::alignment_of<T>::value); }
+
+		void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) T(val); }
+		void destroy(pointer p) { p->~T(); }
+
+		pointer address(reference x) const { return &x; }
+		const_pointer address(const_reference x) const { return &x; }
+		size_type max_size() const { return size_type(-1) / sizeof(T); }
+
+		template <class U>
+		bool operator==(const arena_allocator<U>& rhs) const { return _region == rhs._region; }
+		template <class U>
+		bool operator!=(const arena_allocator<U>& rhs) const { return _region != rhs._region; }
+	};
+
+	template <class T>
+	struct pool_traits<arena_allocator<T> > {
+		static const bool bulk_release = true;
+		static void reserve(arena_allocator<T>& alloc, std::size_t n) { alloc.reserve(n); }
+	};
+}
+
+#endif
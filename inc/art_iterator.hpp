@@ -0,0 +1,71 @@
+#ifndef ART_ITERATOR_HPP
+#define ART_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace ft
+{
+
+							/*----------------*/
+						 /** ART:ITERATOR: */
+						/*----------------*/
+/**	@brief Bidirectional iterator of ft::art_map: a leaf. Leaves form a ring
+ *	through the map's header leaf, so end() is the header and stepping back
+ *	from it lands on the last element. */
+	template<class T, class Leaf>
+	class art_iterator
+	{
+	public:
+
+		typedef Leaf																leaf_type;
+
+		typedef T																		value_type;
+		typedef value_type&													reference;
+		typedef value_type*													pointer;
+
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::bidirectional_iterator_tag			iterator_category;
+
+		leaf_type*		_leaf;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		art_iterator() : _leaf(NULL) {}
+
+//	Initialization constructor
+		explicit art_iterator(leaf_type* leaf) : _leaf(leaf) {}
+
+		// Overload called when trying to copy construct a const_iterator
+		operator art_iterator<const T, Leaf>() const
+		{	return art_iterator<const T, Leaf>(_leaf); }
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return _leaf->_data; }
+
+		pointer	operator->() const { return &(operator*());	}
+
+//	Increment iterator position (pre-increment)
+		art_iterator&	operator++ () {
+			_leaf = _leaf->_next;
+			return *this;
+		}
+
+		art_iterator operator++ (int) { art_iterator tmp(*this);	operator++();	return tmp;	}
+
+//	Decrement iterator position (pre-increment)
+		art_iterator&	operator-- () {
+			_leaf = _leaf->_prev;
+			return *this;
+		}
+
+		art_iterator operator-- (int) { art_iterator tmp(*this);	operator--();	return tmp;	}
+
+		template <class U>
+		bool operator==(const art_iterator<U, Leaf>& rhs) const { return _leaf == rhs._leaf; }
+		template <class U>
+		bool operator!=(const art_iterator<U, Leaf>& rhs) const { return !(*this == rhs); }
+	};
+}
+
+#endif
@@ -0,0 +1,393 @@
+#ifndef _ART_NODE_HPP_
+#define _ART_NODE_HPP_
+
+#include <cstddef>
+#include <cstring>
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
+namespace ft {
+
+	/*----------------*/
+ /**	ART:NODES:    */
+/*----------------*/
+
+/**	@brief Inner node of ft::art_map, in one of four sizes picked by how
+ *	many children it has: up to 4 and up to 16 (key bytes sorted, next to
+ *	the child pointers), up to 48 (a 256-byte index into 48 slots) and 256
+ *	(a pointer per byte value). The path leading to the node may be
+ *	compressed: _prefix_len bytes all its keys share, skipped in one go;
+ *	only the first max_prefix are kept, the others are read from a leaf
+ *	below when needed. A child is a node or, with its low bit set, a leaf. */
+	struct art_node {
+
+		enum { node4, node16, node48, node256 };
+
+		static const std::size_t	max_prefix = 8;
+
+		unsigned char		_type;
+		unsigned short	_count;
+		unsigned int		_prefix_len;
+		unsigned char		_prefix[max_prefix];
+
+		explicit art_node(unsigned char type) : _type(type), _count(0), _prefix_len(0) {}
+
+		static bool is_leaf(const art_node* child) { return reinterpret_cast<std::size_t>(child) & 1; }
+
+		template <class Leaf>
+		static Leaf* leaf(art_node* child) { return reinterpret_cast<Leaf*>(reinterpret_cast<std::size_t>(child) & ~std::size_t(1)); }
+
+		template <class Leaf>
+		static art_node* tag(Leaf* leaf) { return reinterpret_cast<art_node*>(reinterpret_cast<std::size_t>(leaf) | 1); }
+
+		std::size_t capacity() const;
+		bool full() const { return _count == capacity(); }
+
+		art_node** find_child(unsigned char b);
+	/** first child whose byte is greater than 'b', or NULL */
+		art_node* child_above(unsigned char b);
+		art_node* first_child();
+		art_node* last_child();
+	/** the node must not be full, nor hold 'b' */
+		void add_child(unsigned char b, art_node* child);
+		void remove_child(unsigned char b);
+	/** the smallest byte from 'from' on holding a child, 256 if none */
+		std::size_t next_byte(std::size_t from);
+	/** adds every child of this node to 'to', in order */
+		void copy_children(art_node* to);
+	/** the byte of the only child of a node4 */
+		unsigned char only_key() const;
+	};
+
+	struct art_node4 : public art_node {
+		unsigned char	_keys[4];
+		art_node*			_children[4];
+
+		art_node4() : art_node(node4) {
+			std::memset(_keys, 0, sizeof(_keys));
+		}
+	};
+
+	struct art_node16 : public art_node {
+		unsigned char	_keys[16];
+		art_node*			_children[16];
+
+		art_node16() : art_node(node16) {
+			std::memset(_keys, 0, sizeof(_keys));
+		}
+
+	/** number of keys below 'b' (with 'above', not above 'b') */
+		std::size_t rank(unsigned char b, bool above) const {
+#ifdef __SSE2__
+			const __m128i	bias = _mm_set1_epi8(static_cast<char>(0x80));
+			__m128i	keys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_keys)), bias);
+			__m128i	key = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(b)), bias);
+			__m128i	less = above ? _mm_cmpgt_epi8(keys, key) : _mm_cmplt_epi8(keys, key);
+			int			mask = _mm_movemask_epi8(less) & ((1 << _count) - 1);
+			return above ? _count - __builtin_popcount(mask) : __builtin_popcount(mask);
+#else
+			std::size_t i = 0;
+			while (i < _count && (above ? _keys[i] <= b : _keys[i] < b))
+				++i;
+			return i;
+#endif
+		}
+	};
+
+	struct art_node48 : public art_node {
+		unsigned char	_index[256];		// slot + 1, 0 if no child
+		art_node*			_children[48];
+
+		art_node48() : art_node(node48) {
+			std::memset(_index, 0, sizeof(_index));
+			std::memset(_children, 0, sizeof(_children));
+		}
+	};
+
+	struct art_node256 : public art_node {
+		art_node*			_children[256];
+
+		art_node256() : art_node(node256) {
+			std::memset(_children, 0, sizeof(_children));
+		}
+	};
+
+	inline std::size_t art_node::capacity() const {
+		static const std::size_t	capacities[4] = { 4, 16, 48, 256 };
+		return capacities[_type];
+	}
+
+/**	@brief The node16 search compares the 16 key bytes at once (SSE2) */
+	inline art_node** art_node::find_child(unsigned char b) {
+		switch (_type) {
+			case node4: {
+				art_node4* n = static_cast<art_node4*>(this);
+				for (std::size_t i = 0; i < _count; ++i)
+					if (n->_keys[i] == b)
+						return &n->_children[i];
+				return NULL;
+			}
+			case node16: {
+				art_node16* n = static_cast<art_node16*>(this);
+#ifdef __SSE2__
+				__m128i	hits = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(b)),
+																	_mm_loadu_si128(reinterpret_cast<const __m128i*>(n->_keys)));
+				int			mask = _mm_movemask_epi8(hits) & ((1 << _count) - 1);
+				return mask ? &n->_children[__builtin_ctz(mask)] : NULL;
+#else
+				for (std::size_t i = 0; i < _count; ++i)
+					if (n->_keys[i] == b)
+						return &n->_children[i];
+				return NULL;
+#endif
+			}
+			case node48: {
+				art_node48* n = static_cast<art_node48*>(this);
+				return n->_index[b] ? &n->_children[n->_index[b] - 1] : NULL;
+			}
+			default: {
+				art_node256* n = static_cast<art_node256*>(this);
+				return n->_children[b] ? &n->_children[b] : NULL;
+			}
+		}
+	}
+
+	inline art_node* art_node::child_above(unsigned char b) {
+		switch (_type) {
+			case node4: {
+				art_node4* n = static_cast<art_node4*>(this);
+				for (std::size_t i = 0; i < _count; ++i)
+					if (n->_keys[i] > b)
+						return n->_children[i];
+				return NULL;
+			}
+			case node16: {
+				art_node16* n = static_cast<art_node16*>(this);
+				std::size_t i = n->rank(b, true);
+				return i < _count ? n->_children[i] : NULL;
+			}
+			case node48: {
+				art_node48* n = static_cast<art_node48*>(this);
+				for (std::size_t i = b + 1; i < 256; ++i)
+					if (n->_index[i])
+						return n->_children[n->_index[i] - 1];
+				return NULL;
+			}
+			default: {
+				art_node256* n = static_cast<art_node256*>(this);
+				for (std::size_t i = b + 1; i < 256; ++i)
+					if (n->_children[i])
+						return n->_children[i];
+				return NULL;
+			}
+		}
+	}
+
+	inline art_node* art_node::first_child() {
+		switch (_type) {
+			case node4:
+				return static_cast<art_node4*>(this)->_children[0];
+			case node16:
+				return static_cast<art_node16*>(this)->_children[0];
+			case node48: {
+				art_node48* n = static_cast<art_node48*>(this);
+				std::size_t i = 0;
+				while (!n->_index[i])
+					++i;
+				return n->_children[n->_index[i] - 1];
+			}
+			default: {
+				art_node256* n = static_cast<art_node256*>(this);
+				std::size_t i = 0;
+				while (!n->_children[i])
+					++i;
+				return n->_children[i];
+			}
+		}
+	}
+
+	inline art_node* art_node::last_child() {
+		switch (_type) {
+			case node4:
+				return static_cast<art_node4*>(this)->_children[_count - 1];
+			case node16:
+				return static_cast<art_node16*>(this)->_children[_count - 1];
+			case node48: {
+				art_node48* n = static_cast<art_node48*>(this);
+				std::size_t i = 255;
+				while (!n->_index[i])
+					--i;
+				return n->_children[n->_index[i] - 1];
+			}
+			default: {
+				art_node256* n = static_cast<art_node256*>(this);
+				std::size_t i = 255;
+				while (!n->_children[i])
+					--i;
+				return n->_children[i];
+			}
+		}
+	}
+
+	inline void art_node::add_child(unsigned char b, art_node* child) {
+		switch (_type) {
+			case node4: {
+				art_node4* n = static_cast<art_node4*>(this);
+				std::size_t i = 0;
+				while (i < _count && n->_keys[i] < b)
+					++i;
+				std::memmove(n->_keys + i + 1, n->_keys + i, _count - i);
+				std::memmove(n->_children + i + 1, n->_children + i, (_count - i) * sizeof(art_node*));
+				n->_keys[i] = b;
+				n->_children[i] = child;
+				break;
+			}
+			case node16: {
+				art_node16* n = static_cast<art_node16*>(this);
+				std::size_t i = n->rank(b, false);
+				std::memmove(n->_keys + i + 1, n->_keys + i, _count - i);
+				std::memmove(n->_children + i + 1, n->_children + i, (_count - i) * sizeof(art_node*));
+				n->_keys[i] = b;
+				n->_children[i] = child;
+				break;
+			}
+			case node48: {
+				art_node48* n = static_cast<art_node48*>(this);
+				std::size_t slot = 0;
+				while (n->_children[slot])
+					++slot;
+				n->_children[slot] = child;
+				n->_index[b] = static_cast<unsigned char>(slot + 1);
+				break;
+			}
+			default:
+				static_cast<art_node256*>(this)->_children[b] = child;
+		}
+		++_count;
+	}
+
+	inline void art_node::remove_child(unsigned char b) {
+		switch (_type) {
+			case node4: {
+				art_node4* n = static_cast<art_node4*>(this);
+				std::size_t i = 0;
+				while (n->_keys[i] != b)
+					++i;
+				std::memmove(n->_keys + i, n->_keys + i + 1, _count - i - 1);
+				std::memmove(n->_children + i, n->_children + i + 1, (_count - i - 1) * sizeof(art_node*));
+				break;
+			}
+			case node16: {
+				art_node16* n = static_cast<art_node16*>(this);
+				std::size_t i = n->rank(b, false);
+				std::memmove(n->_keys + i, n->_keys + i + 1, _count - i - 1);
+				std::memmove(n->_children + i, n->_children + i + 1, (_count - i - 1) * sizeof(art_node*));
+				n->_keys[_count - 1] = 0;
+				break;
+			}
+			case node48: {
+				art_node48* n = static_cast<art_node48*>(this);
+				n->_children[n->_index[b] - 1] = NULL;
+				n->_index[b] = 0;
+				break;
+			}
+			default:
+				static_cast<art_node256*>(this)->_children[b] = NULL;
+		}
+		--_count;
+	}
+
+	inline std::size_t art_node::next_byte(std::size_t from) {
+		switch (_type) {
+			case node4: {
+				art_node4* n = static_cast<art_node4*>(this);
+				for (std::size_t i = 0; i < _count; ++i)
+					if (n->_keys[i] >= from)
+						return n->_keys[i];
+				return 256;
+			}
+			case node16: {
+				art_node16* n = static_cast<art_node16*>(this);
+				for (std::size_t i = 0; i < _count; ++i)
+					if (n->_keys[i] >= from)
+						return n->_keys[i];
+				return 256;
+			}
+			case node48: {
+				art_node48* n = static_cast<art_node48*>(this);
+				while (from < 256 && !n->_index[from])
+					++from;
+				return from;
+			}
+			default: {
+				art_node256* n = static_cast<art_node256*>(this);
+				while (from < 256 && !n->_children[from])
+					++from;
+				return from;
+			}
+		}
+	}
+
+	inline void art_node::copy_children(art_node* to) {
+		switch (_type) {
+			case node4: {
+				art_node4* n = static_cast<art_node4*>(this);
+				for (std::size_t i = 0; i < _count; ++i)
+					to->add_child(n->_keys[i], n->_children[i]);
+				break;
+			}
+			case node16: {
+				art_node16* n = static_cast<art_node16*>(this);
+				for (std::size_t i = 0; i < _count; ++i)
+					to->add_child(n->_keys[i], n->_children[i]);
+				break;
+			}
+			case node48: {
+				art_node48* n = static_cast<art_node48*>(this);
+				for (std::size_t i = 0; i < 256; ++i)
+					if (n->_index[i])
+						to->add_child(static_cast<unsigned char>(i), n->_children[n->_index[i] - 1]);
+				break;
+			}
+			default: {
+				art_node256* n = static_cast<art_node256*>(this);
+				for (std::size_t i = 0; i < 256; ++i)
+					if (n->_children[i])
+						to->add_child(static_cast<unsigned char>(i), n->_children[i]);
+			}
+		}
+	}
+
+	inline unsigned char art_node::only_key() const {
+		return static_cast<const art_node4*>(this)->_keys[0];
+	}
+
+/**	@brief Leaf of ft::art_map: one element. Leaves are chained in key order
+ *	into a ring closed by the map's header leaf, whose _data is never
+ *	constructed: iteration follows the ring, not the tree. */
+	template <class T>
+	struct art_leaf {
+
+		typedef T		value_type;
+
+		art_leaf*		_prev;
+		art_leaf*		_next;
+		value_type	_data;
+
+	/** links this leaf into the ring right before 'next' */
+		void link_before(art_leaf* next) {
+			_next = next;
+			_prev = next->_prev;
+			_prev->_next = this;
+			next->_prev = this;
+		}
+
+		void unlink() {
+			_prev->_next = _next;
+			_next->_prev = _prev;
+		}
+	};
+}
+
+#endif
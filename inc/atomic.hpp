@@ -0,0 +1,47 @@
+#ifndef _ATOMIC_HPP_
+#define _ATOMIC_HPP_
+
+/**	@brief The few atomic operations the containers need, on the GCC/Clang
+ *	__sync and __atomic builtins since C++98 has no <atomic>. Each
+ *	read-modify-write is a full barrier: whatever was written before it is
+ *	visible to the thread that sees its result. Loads and stores are
+ *	sequentially consistent: a store then a load of another word is never
+ *	reordered, which the epoch scheme in epoch.hpp relies on. */
+
+namespace ft {
+
+	/*--------------*/
+ /**	ATOMICS:   */
+/*--------------*/
+
+/**	@return the new value */
+	inline long atomic_increment(volatile long* value) { return __sync_add_and_fetch(value, 1); }
+
+/**	@return the new value: 0 tells the last owner it is the last */
+	inline long atomic_decrement(volatile long* value) { return __sync_sub_and_fetch(value, 1); }
+
+/**	@brief Replaces *target by 'desired' if it still holds 'expected'
+ *	@return whether it did */
+	inline bool atomic_cas(volatile long* target, long expected, long desired) {
+		return __sync_bool_compare_and_swap(target, expected, desired);
+	}
+
+	template <class T>
+	bool atomic_cas(T* volatile* target, T* expected, T* desired) {
+		return __sync_bool_compare_and_swap(target, expected, desired);
+	}
+
+/**	@brief Stores 'desired' and returns what was there, in one step */
+	template <class T>
+	T* atomic_exchange(T* volatile* target, T* desired) {
+		return __atomic_exchange_n(target, desired, __ATOMIC_SEQ_CST);
+	}
+
+	template <class T>
+	T atomic_load(const volatile T* source) { return __atomic_load_n(source, __ATOMIC_SEQ_CST); }
+
+	template <class T>
+	void atomic_store(volatile T* target, T value) { __atomic_store_n(target, value, __ATOMIC_SEQ_CST); }
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef BTREE_ITERATOR_HPP
+#define BTREE_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace ft
+{
+
+							/*------------------*/
+						 /** BTREE:ITERATOR: */
+						/*------------------*/
+/**	@brief Bidirectional iterator of ft::btree_map: a leaf and a slot in it.
+ *	Leaves form a ring through the map's empty header leaf, so end() is
+ *	slot 0 of the header and stepping back from it lands on the last leaf. */
+	template<class T, class Leaf>
+	class btree_iterator
+	{
+	public:
+
+		typedef Leaf																leaf_type;
+
+		typedef T																		value_type;
+		typedef value_type&													reference;
+		typedef value_type*													pointer;
+
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::bidirectional_iterator_tag			iterator_category;
+
+		leaf_type*		_leaf;
+		std::size_t		_pos;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		btree_iterator() : _leaf(NULL), _pos(0) {}
+
+//	Initialization constructor
+		btree_iterator(leaf_type* leaf, std::size_t pos) : _leaf(leaf), _pos(pos) {}
+
+		// Overload called when trying to copy construct a const_iterator
+		operator btree_iterator<const T, Leaf>() const
+		{	return btree_iterator<const T, Leaf>(_leaf, _pos); }
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return _leaf->value(_pos); }
+
+		pointer	operator->() const { return &(operator*());	}
+
+//	Increment iterator position (pre-increment)
+		btree_iterator&	operator++ () {
+			if (++_pos == _leaf->_count) {
+				_leaf = _leaf->_next;
+				_pos = 0;
+			}
+			return *this;
+		}
+
+		btree_iterator operator++ (int) { btree_iterator tmp(*this);	operator++();	return tmp;	}
+
+//	Decrement iterator position (pre-increment)
+		btree_iterator&	operator-- () {
+			if (_pos == 0) {
+				_leaf = _leaf->_prev;
+				_pos = _leaf->_count;
+			}
+			--_pos;
+			return *this;
+		}
+
+		btree_iterator operator-- (int) { btree_iterator tmp(*this);	operator--();	return tmp;	}
+
+		template <class U>
+		bool operator==(const btree_iterator<U, Leaf>& rhs) const { return _leaf == rhs._leaf && _pos == rhs._pos; }
+		template <class U>
+		bool operator!=(const btree_iterator<U, Leaf>& rhs) const { return !(*this == rhs); }
+	};
+}
+
+#endif
@@ -0,0 +1,350 @@
+#ifndef _BTREE_NODE_HPP_
+#define _BTREE_NODE_HPP_
+
+#include <cstddef>
+#include <new>
+#include <functional>
+#include "enable_if.hpp"
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
+namespace ft {
+
+	/*-------------------*/
+ /**	BTREE:TRAITS:    */
+/*-------------------*/
+
+/**	@brief Node sizes of ft::btree_map: every node is sized to about
+ *	node_bytes (eight cache lines), as many slots as fit and never fewer than 4.
+ *	@leaf_slots: elements per leaf, stored with a copy of their key.
+ *	@inner_slots: children per inner node, which holds one key less. */
+	template <class Key, class Value>
+	struct btree_traits {
+		static const std::size_t	node_bytes = 512;
+
+		static const std::size_t	leaf_fit = (node_bytes - 4 * sizeof(void*)) / (sizeof(Key) + sizeof(Value));
+		static const std::size_t	inner_fit = (node_bytes - 2 * sizeof(void*)) / (sizeof(Key) + sizeof(void*));
+
+		static const std::size_t	leaf_slots = leaf_fit < 4 ? 4 : leaf_fit;
+		static const std::size_t	inner_slots = inner_fit < 4 ? 4 : inner_fit;
+	};
+
+	/*------------------*/
+ /**	BTREE:NODES:    */
+/*------------------*/
+
+/**	@brief What a descent needs to know of any node: leaf or inner,
+ *	and how many keys it holds */
+	struct btree_node_base {
+		std::size_t	_count;
+		bool				_leaf;
+	};
+
+/**	@brief Leaf: up to N elements in key order, with their keys kept apart
+ *	in a packed array so a search reads keys only (and can use SIMD).
+ *	Leaves are chained in order into a ring closed by the map's header leaf.
+ *	Slots past _count hold no object. */
+	template <class Key, class Value, std::size_t N>
+	struct btree_leaf : public btree_node_base {
+
+		typedef Key			key_type;
+		typedef Value		value_type;
+
+		btree_leaf*		_prev;
+		btree_leaf*		_next;
+		typename ft::aligned_storage<N * sizeof(Key), ft::alignment_of<Key>::value>::type			_keys;
+		typename ft::aligned_storage<N * sizeof(Value), ft::alignment_of<Value>::value>::type	_values;
+
+		btree_leaf() : _prev(this), _next(this) {
+			_count = 0;
+			_leaf = true;
+		}
+
+		Key* keys() { return reinterpret_cast<Key*>(&_keys); }
+		const Key* keys() const { return reinterpret_cast<const Key*>(&_keys); }
+		Key& key(std::size_t i) { return keys()[i]; }
+		Value& value(std::size_t i) { return reinterpret_cast<Value*>(&_values)[i]; }
+
+		void construct(std::size_t i, const Value& val) {
+			new (static_cast<void*>(&key(i))) Key(val.first);
+			new (static_cast<void*>(&value(i))) Value(val);
+		}
+
+		void destroy(std::size_t i) {
+			key(i).~Key();
+			value(i).~Value();
+		}
+
+	/** moves slot 'from' of 'src' into the empty slot 'to' */
+		void take(std::size_t to, btree_leaf& src, std::size_t from) {
+			construct(to, src.value(from));
+			src.destroy(from);
+		}
+
+		void insert(std::size_t pos, const Value& val) {
+			for (std::size_t i = _count; i > pos; --i)
+				take(i, *this, i - 1);
+			construct(pos, val);
+			++_count;
+		}
+
+		void erase(std::size_t pos) {
+			destroy(pos);
+			for (std::size_t i = pos + 1; i < _count; ++i)
+				take(i - 1, *this, i);
+			--_count;
+		}
+
+	/** moves the elements of 'src' from 'from' on to the end of this leaf */
+		void append_from(btree_leaf& src, std::size_t from) {
+			for (std::size_t i = from; i < src._count; ++i)
+				take(_count++, src, i);
+			src._count = from;
+		}
+
+		void clear() {
+			for (std::size_t i = 0; i < _count; ++i)
+				destroy(i);
+			_count = 0;
+		}
+
+	/** links this leaf into the ring right after 'prev' */
+		void link_after(btree_leaf* prev) {
+			_prev = prev;
+			_next = prev->_next;
+			_next->_prev = this;
+			prev->_next = this;
+		}
+
+		void unlink() {
+			_prev->_next = _next;
+			_next->_prev = _prev;
+		}
+	};
+
+/**	@brief Inner node: _count separator keys and _count + 1 children (N at most);
+ *	child i holds the keys k with key(i - 1) <= k < key(i). */
+	template <class Key, std::size_t N>
+	struct btree_inner : public btree_node_base {
+
+		typedef Key			key_type;
+
+		typename ft::aligned_storage<(N - 1) * sizeof(Key), ft::alignment_of<Key>::value>::type	_keys;
+		btree_node_base*	_children[N];
+
+		btree_inner() {
+			_count = 0;
+			_leaf = false;
+		}
+
+		Key* keys() { return reinterpret_cast<Key*>(&_keys); }
+		const Key* keys() const { return reinterpret_cast<const Key*>(&_keys); }
+		Key& key(std::size_t i) { return keys()[i]; }
+
+		void construct_key(std::size_t i, const Key& k) { new (static_cast<void*>(&key(i))) Key(k); }
+		void destroy_key(std::size_t i) { key(i).~Key(); }
+
+	/** 'k' must not be one of this node's own keys */
+		void set_key(std::size_t i, const Key& k) {
+			destroy_key(i);
+			construct_key(i, k);
+		}
+
+		void take_key(std::size_t to, btree_inner& src, std::size_t from) {
+			construct_key(to, src.key(from));
+			src.destroy_key(from);
+		}
+
+	/** puts 'k' at 'pos' and 'child' right after it (child pos + 1) */
+		void insert(std::size_t pos, const Key& k, btree_node_base* child) {
+			for (std::size_t i = _count; i > pos; --i) {
+				take_key(i, *this, i - 1);
+				_children[i + 1] = _children[i];
+			}
+			construct_key(pos, k);
+			_children[pos + 1] = child;
+			++_count;
+		}
+
+	/** removes key 'pos' and the child after it */
+		void erase(std::size_t pos) {
+			destroy_key(pos);
+			for (std::size_t i = pos + 1; i < _count; ++i) {
+				take_key(i - 1, *this, i);
+				_children[i] = _children[i + 1];
+			}
+			--_count;
+		}
+
+		void push_front(const Key& k, btree_node_base* child) {
+			_children[_count + 1] = _children[_count];
+			for (std::size_t i = _count; i > 0; --i) {
+				take_key(i, *this, i - 1);
+				_children[i] = _children[i - 1];
+			}
+			construct_key(0, k);
+			_children[0] = child;
+			++_count;
+		}
+
+		void push_back(const Key& k, btree_node_base* child) {
+			construct_key(_count, k);
+			_children[++_count] = child;
+		}
+
+		void pop_front() {
+			destroy_key(0);
+			_children[0] = _children[1];
+			for (std::size_t i = 1; i < _count; ++i) {
+				take_key(i - 1, *this, i);
+				_children[i] = _children[i + 1];
+			}
+			--_count;
+		}
+
+		void pop_back() { destroy_key(--_count); }
+
+	/** moves keys [from, _count) and the children right of them to the
+	 *	empty 'right', whose first child becomes child 'from' */
+		void split(std::size_t from, btree_inner& right) {
+			right._children[0] = _children[from];
+			for (std::size_t i = from; i < _count; ++i) {
+				right.take_key(right._count, *this, i);
+				right._children[++right._count] = _children[i + 1];
+			}
+			_count = from;
+		}
+
+	/** appends 'sep' then all of 'right', which is left empty */
+		void merge(const Key& sep, btree_inner& right) {
+			push_back(sep, right._children[0]);
+			for (std::size_t i = 0; i < right._count; ++i) {
+				take_key(_count, right, i);
+				_children[++_count] = right._children[i + 1];
+			}
+			right._count = 0;
+		}
+	};
+
+	/*-------------------*/
+ /**	BTREE:SEARCH:    */
+/*-------------------*/
+
+/**	@brief Position of a key inside a node: binary search with the map's
+ *	comparator. Specialised below for arithmetic keys under std::less,
+ *	where a linear SSE2 scan compares 4 (or 2) keys per instruction and
+ *	stops at the first block that is not entirely below the key. */
+	template <class Key, class Compare>
+	struct btree_search {
+
+	/** first position whose key is not less than 'k' */
+		static std::size_t lower(const Key* keys, std::size_t n, const Key& k, const Compare& comp) {
+			std::size_t lo = 0;
+			while (lo < n) {
+				std::size_t mid = lo + (n - lo) / 2;
+				if (comp(keys[mid], k))
+					lo = mid + 1;
+				else
+					n = mid;
+			}
+			return lo;
+		}
+
+	/** first position whose key is greater than 'k' */
+		static std::size_t upper(const Key* keys, std::size_t n, const Key& k, const Compare& comp) {
+			std::size_t lo = 0;
+			while (lo < n) {
+				std::size_t mid = lo + (n - lo) / 2;
+				if (comp(k, keys[mid]))
+					n = mid;
+				else
+					lo = mid + 1;
+			}
+			return lo;
+		}
+	};
+
+#ifdef __SSE2__
+	template <>
+	struct btree_search<int, std::less<int> > {
+
+		// keys below (or not above, 'upper') k in the first block that is not full of them
+		static std::size_t scan(const int* keys, std::size_t n, int k, bool upper) {
+			const __m128i	key = _mm_set1_epi32(k);
+			std::size_t		i = 0;
+			for (; i + 4 <= n; i += 4) {
+				__m128i	block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+				__m128i	above = upper ? _mm_cmpgt_epi32(block, key) : _mm_cmpgt_epi32(key, block);
+				int			mask = _mm_movemask_ps(_mm_castsi128_ps(above));
+				if (upper)
+					mask = ~mask & 0xf;
+				if (mask != 0xf)
+					return i + __builtin_popcount(mask);
+			}
+			while (i < n && (upper ? keys[i] <= k : keys[i] < k))
+				++i;
+			return i;
+		}
+
+		static std::size_t lower(const int* keys, std::size_t n, const int& k, const std::less<int>&) {
+			return scan(keys, n, k, false);
+		}
+		static std::size_t upper(const int* keys, std::size_t n, const int& k, const std::less<int>&) {
+			return scan(keys, n, k, true);
+		}
+	};
+
+	template <>
+	struct btree_search<float, std::less<float> > {
+
+		static std::size_t scan(const float* keys, std::size_t n, float k, bool upper) {
+			const __m128	key = _mm_set1_ps(k);
+			std::size_t		i = 0;
+			for (; i + 4 <= n; i += 4) {
+				__m128	block = _mm_loadu_ps(keys + i);
+				int			mask = _mm_movemask_ps(upper ? _mm_cmple_ps(block, key) : _mm_cmplt_ps(block, key));
+				if (mask != 0xf)
+					return i + __builtin_popcount(mask);
+			}
+			while (i < n && (upper ? keys[i] <= k : keys[i] < k))
+				++i;
+			return i;
+		}
+
+		static std::size_t lower(const float* keys, std::size_t n, const float& k, const std::less<float>&) {
+			return scan(keys, n, k, false);
+		}
+		static std::size_t upper(const float* keys, std::size_t n, const float& k, const std::less<float>&) {
+			return scan(keys, n, k, true);
+		}
+	};
+
+	template <>
+	struct btree_search<double, std::less<double> > {
+
+		static std::size_t scan(const double* keys, std::size_t n, double k, bool upper) {
+			const __m128d	key = _mm_set1_pd(k);
+			std::size_t		i = 0;
+			for (; i + 2 <= n; i += 2) {
+				__m128d	block = _mm_loadu_pd(keys + i);
+				int			mask = _mm_movemask_pd(upper ? _mm_cmple_pd(block, key) : _mm_cmplt_pd(block, key));
+				if (mask != 0x3)
+					return i + (mask & 1);
+			}
+			while (i < n && (upper ? keys[i] <= k : keys[i] < k))
+				++i;
+			return i;
+		}
+
+		static std::size_t lower(const double* keys, std::size_t n, const double& k, const std::less<double>&) {
+			return scan(keys, n, k, false);
+		}
+		static std::size_t upper(const double* keys, std::size_t n, const double& k, const std::less<double>&) {
+			return scan(keys, n, k, true);
+		}
+	};
+#endif
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef COMPACT_ITERATOR_HPP
+#define COMPACT_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace ft
+{
+
+							/*--------------------*/
+						 /** COMPACT:ITERATOR: */
+						/*--------------------*/
+/**	@brief Bidirectional iterator of index linked trees (ft::compact_map):
+ *	the node storage it walks and the index of its node. The storage is the
+ *	container's, which moves with the elements on swap and is never
+ *	replaced, so iterators survive it growing underneath.
+ *	Stepping is done by the node type (Node::increment/decrement). */
+	template<class T, class Storage>
+	class compact_iterator
+	{
+	public:
+
+		typedef Storage															storage_type;
+		typedef typename Storage::value_type				node_type;
+		typedef typename node_type::index_type			index_type;
+
+		typedef T																		value_type;
+		typedef value_type&													reference;
+		typedef value_type*													pointer;
+
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::bidirectional_iterator_tag			iterator_category;
+
+		storage_type*	_nodes;
+		index_type		_index;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		compact_iterator() : _nodes(NULL), _index(0) {}
+
+//	Initialization constructor
+		compact_iterator(storage_type* nodes, index_type index) : _nodes(nodes), _index(index) {}
+
+		// Overload called when trying to copy construct a const_iterator
+		operator compact_iterator<const T, Storage>() const
+		{	return compact_iterator<const T, Storage>(_nodes, _index); }
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return (*_nodes)[_index]._data; }
+
+		pointer	operator->() const { return &(operator*());	}
+
+//	Increment iterator position (pre-increment)
+		compact_iterator&	operator++ () { _index = node_type::increment(*_nodes, _index); return *this; }
+
+		compact_iterator operator++ (int) { compact_iterator tmp(*this);	operator++();	return tmp;	}
+
+//	Decrement iterator position (pre-increment)
+		compact_iterator&	operator-- () { _index = node_type::decrement(*_nodes, _index); return *this; }
+
+		compact_iterator operator-- (int) { compact_iterator tmp(*this);	operator--();	return tmp;	}
+
+		template <class U>
+		bool operator==(const compact_iterator<U, Storage>& rhs) const { return _index == rhs._index && _nodes == rhs._nodes; }
+		template <class U>
+		bool operator!=(const compact_iterator<U, Storage>& rhs) const { return !(*this == rhs); }
+	};
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef _COMPARE_HPP_
+#define _COMPARE_HPP_
+
+#include <string>
+#include "enable_if.hpp"
+
+namespace ft {
+
+	/*---------------------------*/
+ /**	TRANSPARENT:COMPARATORS: */
+/*---------------------------*/
+
+/**	@brief Whether Compare declares a nested 'is_transparent' type, which is
+ *	how a comparator says it can compare keys with other key-like types:
+ *	the ordered containers then accept those in their lookups instead of
+ *	building a key_type for every call */
+	template <class Compare>
+	struct is_transparent {
+		private:
+			typedef char	yes;
+			typedef char	(&no)[2];
+
+			template <class C>
+			static yes test(typename C::is_transparent*);
+			template <class C>
+			static no test(...);
+
+		public:
+			static const bool value = sizeof(test<Compare>(NULL)) == sizeof(yes);
+	};
+
+/**	@brief enable_if for the lookup templates of a container: also depends
+ *	on the looked up type K, so that the member declaration only fails
+ *	(quietly) when the template is called, not when the container is built */
+	template <class Compare, class K, class T>
+	struct enable_transparent : public ft::enable_if<ft::is_transparent<Compare>::value, T> {};
+
+/**	@brief Whether Compare declares a nested 'is_three_way' type: it then
+ *	also has an int compare(a, b) const giving <0, 0 or >0, and the ordered
+ *	containers settle each level of a search with one key comparison and
+ *	stop where the key is found. Its operator() must agree with it. */
+	template <class Compare>
+	struct is_three_way {
+		private:
+			typedef char	yes;
+			typedef char	(&no)[2];
+
+			template <class C>
+			static yes test(typename C::is_three_way*);
+			template <class C>
+			static no test(...);
+
+		public:
+			static const bool value = sizeof(test<Compare>(NULL)) == sizeof(yes);
+	};
+
+/**	@brief <0, 0 or >0 as 'a' is less than, equivalent to or greater than 'b';
+ *	strings use compare(), which reads them once, anything else operator< */
+	template <class A, class B>
+	int three_way(const A& a, const B& b) { return a < b ? -1 : b < a; }
+
+	inline int three_way(const std::string& a, const std::string& b) { return a.compare(b); }
+	inline int three_way(const std::string& a, const char* b) { return a.compare(b); }
+	inline int three_way(const char* a, const std::string& b) { return -b.compare(a); }
+
+/**	@brief Three-way (and transparent) comparator built on ft::three_way */
+	struct three_way_less {
+		typedef void	is_three_way;
+		typedef void	is_transparent;
+
+		template <class A, class B>
+		bool operator() (const A& a, const B& b) const { return three_way(a, b) < 0; }
+
+	/** unqualified, so the overloads of the argument types are found too */
+		template <class A, class B>
+		int compare(const A& a, const B& b) const { return three_way(a, b); }
+	};
+
+/**	@brief operator< between any two types that have one, the C++98 stand-in
+ *	for std::less<void>: ft::map<std::string, T, ft::transparent_less>
+ *	finds a const char* without turning it into a std::string */
+	struct transparent_less {
+		typedef void	is_transparent;
+
+		template <class A, class B>
+		bool operator() (const A& a, const B& b) const { return a < b; }
+	};
+}
+
+#endif
@@ -12,7 +12,10 @@ namespace ft {
 	typename ft::iterator_traits<InputIterator>::difference_type
 	_distance(InputIterator first, InputIterator last, std::input_iterator_tag,
 	typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) {
-		while (first != last)	{ first++; } return *first;
+		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
+		for (; first != last; ++first)
+			++n;
+		return n;
 	}
 
 	template <class random_access_iterator>
@@ -8,6 +8,8 @@
   * when integers are given as arguments
   */ 
 
+#include <cstddef>
+
 namespace ft {
 
  /**If B is true, enable_if has a public member typedef type, equal to T;
@@ -74,6 +76,43 @@ namespace ft {
 		template<>	struct is_integral_type<unsigned long long int> 	: public true_type {};
 
 		template<typename T> struct is_integral : is_integral_type<T> {};
+
+		// Whether destroying a T runs no code (compiler builtin, false when unknown)
+		template<typename T>
+		struct is_trivially_destructible : public integral_constant<bool,
+#if defined(__GNUC__) || defined(__clang__)
+			__has_trivial_destructor(T)
+#else
+			false
+#endif
+		> {};
+
+		// T without its top-level const
+		template<typename T>	struct remove_const						{ typedef T type; };
+		template<typename T>	struct remove_const<const T>		{ typedef T type; };
+
+		// Alignment requirement of T: the padding a char forces in front of it
+		template<typename T>
+		struct alignment_of {
+			struct helper { char c; T t; };
+			static const std::size_t value = sizeof(helper) - sizeof(T);
+		};
+
+		// A fundamental type aligned on 'Align' bytes (the strictest one past 8)
+		template<std::size_t Align>	struct type_with_alignment		{ typedef long double type; };
+		template<>	struct type_with_alignment<1>										{ typedef char type; };
+		template<>	struct type_with_alignment<2>										{ typedef short type; };
+		template<>	struct type_with_alignment<4>										{ typedef int type; };
+		template<>	struct type_with_alignment<8>										{ typedef long long type; };
+
+		// Raw storage of 'Len' bytes aligned on 'Align': room for objects built later in place
+		template<std::size_t Len, std::size_t Align>
+		struct aligned_storage {
+			union type {
+				unsigned char																data[Len];
+				typename type_with_alignment<Align>::type		align;
+			};
+		};
 	}
 
 
@@ -0,0 +1,183 @@
+#ifndef _EPOCH_HPP_
+#define _EPOCH_HPP_
+
+#include <cstddef>
+#include <pthread.h>
+#include "atomic.hpp"
+
+namespace ft {
+
+	/*----------------------------*/
+ /**	EPOCH:BASED:RECLAMATION: */
+/*----------------------------*/
+
+/**	@brief Frees memory that lock-free readers may still be looking at, once
+ *	they cannot be any more. Threads enter() the domain before touching
+ *	shared nodes and exit() after; a node taken out of the structure is
+ *	retire()d rather than freed. The domain keeps a global epoch, which
+ *	only moves from e to e + 1 once every thread inside has entered during
+ *	e: a node retired during e - 1 was unlinked before any of them came in,
+ *	so it is freed then. Readers never wait; the cost to them is a fenced
+ *	store on enter() and another on exit(). Entering nests.
+ *	Each thread gets a record on its first enter(), found again through a
+ *	one-entry thread-local cache (GCC's __thread); records of finished
+ *	threads stay idle until the domain goes. */
+	class epoch_domain {
+
+		public:
+			typedef void	(*reclaim_function)(void* context, void* ptr);
+
+		private:
+			struct record {
+				volatile long	state;				// epoch << 1 | inside
+				pthread_t			owner;
+				int						nesting;			// only touched by the owner
+				record*				next;
+			};
+
+			struct retired {
+				retired*					next;
+				void*							ptr;
+				reclaim_function	reclaim;
+				void*							context;
+			};
+
+			static const long	advance_every = 64;
+
+			volatile long				_epoch;
+			record* volatile		_records;
+			retired* volatile		_limbo[3];			// by retiring epoch, modulo 3
+			volatile long				_retired;
+			long								_id;
+
+			epoch_domain(const epoch_domain&);
+			epoch_domain& operator= (const epoch_domain&);
+
+		public:
+			epoch_domain() : _epoch(0), _records(NULL), _retired(0), _id(_next_id()) {
+				_limbo[0] = NULL;
+				_limbo[1] = NULL;
+				_limbo[2] = NULL;
+			}
+
+		/** no thread may be inside any more */
+			~epoch_domain() {
+				reclaim_all();
+				while (_records) {
+					record* next = _records->next;
+					delete _records;
+					_records = next;
+				}
+			}
+
+			void enter() {
+				record* rec = _record();
+				if (rec->nesting++ == 0)
+					ft::atomic_store(&rec->state, ft::atomic_load(&_epoch) << 1 | 1);
+			}
+
+			void exit() {
+				record* rec = _record();
+				if (--rec->nesting == 0)
+					ft::atomic_store(&rec->state, 0L);
+			}
+
+		/** hands 'ptr' over, to be passed to reclaim(context, ptr) once no
+		 *	thread can reach it; to be called inside the domain, after 'ptr'
+		 *	was made unreachable */
+			void retire(void* ptr, reclaim_function reclaim, void* context) {
+				retired* entry = new retired;
+				entry->ptr = ptr;
+				entry->reclaim = reclaim;
+				entry->context = context;
+				retired* volatile* slot = &_limbo[ft::atomic_load(&_epoch) % 3];
+				do
+					entry->next = ft::atomic_load(slot);
+				while (!ft::atomic_cas(slot, entry->next, entry));
+				if (ft::atomic_increment(&_retired) % advance_every == 0)
+					try_advance();
+			}
+
+		/** moves the epoch on if every thread inside has seen the current
+		 *	one, then frees what was retired two epochs back */
+			bool try_advance() {
+				long epoch = ft::atomic_load(&_epoch);
+				for (record* rec = ft::atomic_load(&_records); rec; rec = rec->next) {
+					long state = ft::atomic_load(&rec->state);
+					if ((state & 1) && (state >> 1) != epoch)
+						return false;
+				}
+				if (!ft::atomic_cas(&_epoch, epoch, epoch + 1))
+					return false;
+				_reclaim(ft::atomic_exchange(&_limbo[(epoch + 2) % 3], static_cast<retired*>(NULL)));
+				return true;
+			}
+
+		/** frees everything retired: no thread may be inside */
+			void reclaim_all() {
+				for (int i = 0; i < 3; ++i)
+					_reclaim(ft::atomic_exchange(&_limbo[i], static_cast<retired*>(NULL)));
+			}
+
+		private:
+			static long _next_id() {
+				static volatile long	ids = 0;
+				return ft::atomic_increment(&ids);
+			}
+
+			static void _reclaim(retired* entry) {
+				while (entry) {
+					retired* next = entry->next;
+					entry->reclaim(entry->context, entry->ptr);
+					delete entry;
+					entry = next;
+				}
+			}
+
+		/** this thread's record: from the cache, else by owner, else a new one */
+			record* _record() {
+#if defined(__GNUC__)
+				static __thread const epoch_domain*	cached_domain = NULL;
+				static __thread long								cached_id = 0;
+				static __thread record*							cached_record = NULL;
+				if (cached_domain == this && cached_id == _id)
+					return cached_record;
+#endif
+				pthread_t self = pthread_self();
+				record* rec = ft::atomic_load(&_records);
+				while (rec && !pthread_equal(rec->owner, self))
+					rec = rec->next;
+				if (!rec) {
+					rec = new record;
+					rec->state = 0;
+					rec->owner = self;
+					rec->nesting = 0;
+					do
+						rec->next = ft::atomic_load(&_records);
+					while (!ft::atomic_cas(&_records, rec->next, rec));
+				}
+#if defined(__GNUC__)
+				cached_domain = this;
+				cached_id = _id;
+				cached_record = rec;
+#endif
+				return rec;
+			}
+	};
+
+/**	@brief Inside 'domain' from construction to destruction */
+	class epoch_guard {
+
+		public:
+			explicit epoch_guard(epoch_domain& domain) : _domain(domain) { _domain.enter(); }
+			~epoch_guard() { _domain.exit(); }
+
+		private:
+			epoch_domain&	_domain;
+
+			epoch_guard(const epoch_guard&);
+			epoch_guard& operator= (const epoch_guard&);
+	};
+}
+
+#endif
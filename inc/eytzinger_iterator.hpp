@@ -0,0 +1,117 @@
+#ifndef EYTZINGER_ITERATOR_HPP
+#define EYTZINGER_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+#include "pair.hpp"
+#include "flat_iterator.hpp"
+
+namespace ft
+{
+
+							/*---------------------*/
+						 /** EYTZINGER:LAYOUT: */
+						/*---------------------*/
+/**	Positions are 1-based: the root is 1 and the children of k are 2k and
+ *	2k + 1, stored at array index k - 1. Going up from k past every turn of
+ *	one side and then one more level drops the trailing run of that bit and
+ *	the bit after it: one shift, 0 when there is nothing left above. */
+
+/**	@brief the node after which k's subtree ends when walking left to right:
+ *	climbs while k is a right child, then once more */
+	inline std::size_t eytzinger_after(std::size_t k) {
+#if defined(__GNUC__) || defined(__clang__)
+		return k >> (__builtin_ctzl(~k) + 1);
+#else
+		while (k & 1)
+			k >>= 1;
+		return k >> 1;
+#endif
+	}
+
+/**	@brief mirror of eytzinger_after: climbs while k is a left child, then once more */
+	inline std::size_t eytzinger_before(std::size_t k) {
+#if defined(__GNUC__) || defined(__clang__)
+		return k >> (__builtin_ctzl(k) + 1);
+#else
+		while (!(k & 1))
+			k >>= 1;
+		return k >> 1;
+#endif
+	}
+
+							/*----------------------*/
+						 /** EYTZINGER:ITERATOR: */
+						/*----------------------*/
+/**	@brief Bidirectional iterator of ft::frozen_map: an in-order walk of the
+ *	implicit tree laid out in the key and value arrays. _pos is the
+ *	1-based position, 0 being end(). A step goes down to the next subtree
+ *	or up with eytzinger_after/before, no stack and no parent pointer. */
+	template<class Key, class Mapped>
+	class eytzinger_iterator
+	{
+	public:
+
+		typedef ft::pair<const Key, Mapped>					value_type;
+		typedef ft::flat_reference<Key, Mapped>			reference;
+		typedef typename ft::flat_iterator<Key, Mapped>::pointer	pointer;
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::bidirectional_iterator_tag			iterator_category;
+
+		const Key*		_key;
+		Mapped*				_value;
+		std::size_t		_size;
+		std::size_t		_pos;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		eytzinger_iterator() : _key(NULL), _value(NULL), _size(0), _pos(0) {}
+
+//	Initialization constructor
+		eytzinger_iterator(const Key* key, Mapped* value, std::size_t size, std::size_t pos) :
+		_key(key), _value(value), _size(size), _pos(pos) {}
+
+		// Overload called when trying to copy construct a const_iterator
+		operator eytzinger_iterator<Key, const Mapped>() const
+		{	return eytzinger_iterator<Key, const Mapped>(_key, _value, _size, _pos); }
+
+//	Deference iterator:	Returns the key and value the iterator is on
+		reference	operator*() const { return reference(_key[_pos - 1], _value[_pos - 1]); }
+
+		pointer	operator->() const { return pointer(operator*()); }
+
+	/** leftmost node under the right child, or up past the right turns */
+		eytzinger_iterator&	operator++ () {
+			if (2 * _pos + 1 <= _size) {
+				_pos = 2 * _pos + 1;
+				while (2 * _pos <= _size)
+					_pos = 2 * _pos;
+			}
+			else
+				_pos = eytzinger_after(_pos);
+			return *this;
+		}
+
+	/** from end() onto the rightmost node, else the mirror of ++ */
+		eytzinger_iterator&	operator-- () {
+			if (_pos == 0 || 2 * _pos <= _size) {
+				_pos = _pos == 0 ? 1 : 2 * _pos;
+				while (2 * _pos + 1 <= _size)
+					_pos = 2 * _pos + 1;
+			}
+			else
+				_pos = eytzinger_before(_pos);
+			return *this;
+		}
+
+		eytzinger_iterator		operator++ (int) { eytzinger_iterator tmp(*this);	operator++();	return tmp;	}
+		eytzinger_iterator		operator-- (int) { eytzinger_iterator tmp(*this);	operator--();	return tmp;	}
+
+		template <class U>
+		bool operator==(const eytzinger_iterator<Key, U>& rhs) const { return _pos == rhs._pos; }
+		template <class U>
+		bool operator!=(const eytzinger_iterator<Key, U>& rhs) const { return _pos != rhs._pos; }
+	};
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef FLAT_ITERATOR_HPP
+#define FLAT_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+#include "pair.hpp"
+
+namespace ft
+{
+
+							/*------------------*/
+						 /** FLAT:REFERENCE: */
+						/*------------------*/
+/**	@brief What dereferencing a flat_map iterator gives: the key and the mapped
+ *	value live in two arrays, so there is no pair in memory to point at.
+ *	It reads like one (->first, ->second) and converts to a pair by copy. */
+	template<class Key, class Mapped>
+	struct flat_reference
+	{
+		const Key&	first;
+		Mapped&			second;
+
+		flat_reference(const Key& key, Mapped& value) : first(key), second(value) {}
+
+		template <class K, class V>
+		operator ft::pair<K, V>() const { return ft::pair<K, V>(first, second); }
+	};
+
+							/*-----------------*/
+						 /** FLAT:ITERATOR: */
+						/*-----------------*/
+/**	@brief Random access iterator of ft::flat_map: one pointer into the key
+ *	array and one into the value array, moved together.
+ *	operator-> returns the reference wrapped in a small object whose own
+ *	operator-> hands out its address, so it->second works as for ft::map. */
+	template<class Key, class Mapped>
+	class flat_iterator
+	{
+	public:
+
+		typedef ft::pair<const Key, Mapped>					value_type;
+		typedef ft::flat_reference<Key, Mapped>			reference;
+
+		class pointer {
+			public:
+				explicit pointer(const reference& ref) : _ref(ref) {}
+				const reference* operator->() const { return &_ref; }
+			private:
+				reference	_ref;
+		};
+
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::random_access_iterator_tag			iterator_category;
+
+		const Key*	_key;
+		Mapped*			_value;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		flat_iterator() : _key(NULL), _value(NULL) {}
+
+//	Initialization constructor
+		flat_iterator(const Key* key, Mapped* value) : _key(key), _value(value) {}
+
+		// Overload called when trying to copy construct a const_iterator
+		operator flat_iterator<Key, const Mapped>() const
+		{	return flat_iterator<Key, const Mapped>(_key, _value); }
+
+//	Deference iterator:	Returns the key and value the iterator is on
+		reference	operator*() const { return reference(*_key, *_value); }
+
+		pointer	operator->() const { return pointer(operator*()); }
+
+		reference	operator[](difference_type n) const { return reference(_key[n], _value[n]); }
+
+		flat_iterator&	operator++ () { ++_key; ++_value; return *this; }
+		flat_iterator		operator++ (int) { flat_iterator tmp(*this);	operator++();	return tmp;	}
+		flat_iterator&	operator-- () { --_key; --_value; return *this; }
+		flat_iterator		operator-- (int) { flat_iterator tmp(*this);	operator--();	return tmp;	}
+
+		flat_iterator&	operator+= (difference_type n) { _key += n; _value += n; return *this; }
+		flat_iterator&	operator-= (difference_type n) { _key -= n; _value -= n; return *this; }
+		flat_iterator		operator+ (difference_type n) const { return flat_iterator(_key + n, _value + n); }
+		flat_iterator		operator- (difference_type n) const { return flat_iterator(_key - n, _value - n); }
+
+		template <class U>
+		difference_type	operator- (const flat_iterator<Key, U>& rhs) const { return _key - rhs._key; }
+
+		template <class U>
+		bool operator==(const flat_iterator<Key, U>& rhs) const { return _key == rhs._key; }
+		template <class U>
+		bool operator!=(const flat_iterator<Key, U>& rhs) const { return _key != rhs._key; }
+		template <class U>
+		bool operator<(const flat_iterator<Key, U>& rhs) const { return _key < rhs._key; }
+		template <class U>
+		bool operator>(const flat_iterator<Key, U>& rhs) const { return _key > rhs._key; }
+		template <class U>
+		bool operator<=(const flat_iterator<Key, U>& rhs) const { return _key <= rhs._key; }
+		template <class U>
+		bool operator>=(const flat_iterator<Key, U>& rhs) const { return _key >= rhs._key; }
+	};
+
+	template<class Key, class Mapped>
+	flat_iterator<Key, Mapped> operator+ (typename flat_iterator<Key, Mapped>::difference_type n,
+																				const flat_iterator<Key, Mapped>& it) { return it + n; }
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef _HASH_HPP_
+#define _HASH_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <stdint.h>
+#include "pair.hpp"
+
+namespace ft {
+
+	/*--------------*/
+ /**	HASHING:   */
+/*--------------*/
+
+/**	@brief Default hash functors of the unordered containers.
+ *	Open addressing takes the slot from the high bits of the hash and a
+ *	7-bit tag from the low ones, so every input bit has to reach both ends:
+ *	integers are not hashed to themselves but run through a multiply-xorshift
+ *	mix (the murmur3 finaliser). Strings are read 8 bytes at a time.
+ *	There is no generic version: hashing a type without a specialisation
+ *	below is a compile error, as with std::hash. */
+	template <class T>
+	struct hash;
+
+	inline std::size_t hash_mix(uint64_t x) {
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		x *= 0xc4ceb9fe1a85ec53ULL;
+		x ^= x >> 33;
+		return static_cast<std::size_t>(x);
+	}
+
+/** hashes 'len' bytes; the length goes in too, so "a" and "a\0" differ */
+	inline std::size_t hash_bytes(const void* data, std::size_t len) {
+		const unsigned char*	bytes = static_cast<const unsigned char*>(data);
+		uint64_t							h = 0x9e3779b97f4a7c15ULL ^ (len * 0x100000001b3ULL);
+		uint64_t							word;
+
+		for (; len >= 8; bytes += 8, len -= 8) {
+			std::memcpy(&word, bytes, 8);
+			h = (h ^ hash_mix(word)) * 0x100000001b3ULL;
+		}
+		word = 0;
+		for (std::size_t i = 0; i < len; ++i)
+			word |= uint64_t(bytes[i]) << (8 * i);
+		return hash_mix(h ^ word);
+	}
+
+/** folds the hash of a second value into 'seed' (the order matters) */
+	inline std::size_t hash_combine(std::size_t seed, std::size_t value) {
+		return hash_mix(seed ^ (value + 0x9e3779b97f4a7c15ULL + (uint64_t(seed) << 6) + (seed >> 2)));
+	}
+
+#define FT_INTEGER_HASH(T)																																		\
+	template <>																																							\
+	struct hash<T> {																																				\
+		std::size_t operator() (T value) const { return hash_mix(static_cast<uint64_t>(value)); }	\
+	};
+
+	FT_INTEGER_HASH(bool)
+	FT_INTEGER_HASH(char)
+	FT_INTEGER_HASH(signed char)
+	FT_INTEGER_HASH(unsigned char)
+	FT_INTEGER_HASH(wchar_t)
+	FT_INTEGER_HASH(short)
+	FT_INTEGER_HASH(unsigned short)
+	FT_INTEGER_HASH(int)
+	FT_INTEGER_HASH(unsigned int)
+	FT_INTEGER_HASH(long)
+	FT_INTEGER_HASH(unsigned long)
+	FT_INTEGER_HASH(long long)
+	FT_INTEGER_HASH(unsigned long long)
+
+#undef FT_INTEGER_HASH
+
+	template <class T>
+	struct hash<const T> : public hash<T> {};
+
+	template <class T>
+	struct hash<T*> {
+		std::size_t operator() (T* ptr) const { return hash_mix(reinterpret_cast<uintptr_t>(ptr)); }
+	};
+
+	template <>
+	struct hash<std::string> {
+		std::size_t operator() (const std::string& str) const { return hash_bytes(str.data(), str.size()); }
+	};
+
+	template <class T1, class T2>
+	struct hash<ft::pair<T1, T2> > {
+		std::size_t operator() (const ft::pair<T1, T2>& pr) const {
+			return hash_combine(hash<T1>()(pr.first), hash<T2>()(pr.second));
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef HASH_ITERATOR_HPP
+#define HASH_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace ft
+{
+
+/**	@brief Control byte of a hash_table slot: a full slot holds the low
+ *	7 bits of its element's hash (0 to 127), the others one of these. */
+	struct hash_ctrl {
+		static const signed char	empty = -128;
+		static const signed char	deleted = -2;		// erased, probes go on past it
+		static const signed char	sentinel = -1;	// one past the last slot
+	};
+
+							/*-----------------*/
+						 /** HASH:ITERATOR: */
+						/*-----------------*/
+/**	@brief Forward iterator of the open-addressing tables (ft::unordered_map,
+ *	ft::unordered_set): a control byte and the slot it describes, moved
+ *	together past the empty and erased slots. The control array ends with
+ *	a sentinel byte, which is where end() sits and where ++ stops. */
+	template<class T>
+	class hash_iterator
+	{
+	public:
+
+		typedef T																		value_type;
+		typedef value_type&													reference;
+		typedef value_type*													pointer;
+
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::forward_iterator_tag						iterator_category;
+
+		const signed char*	_ctrl;
+		pointer							_slot;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		hash_iterator() : _ctrl(NULL), _slot(NULL) {}
+
+//	Initialization constructor: moves on to the first full slot from there
+		hash_iterator(const signed char* ctrl, pointer slot) : _ctrl(ctrl), _slot(slot) { _skip(); }
+
+		// Overload called when trying to copy construct a const_iterator
+		operator hash_iterator<const T>() const
+		{	return hash_iterator<const T>(_ctrl, _slot); }
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return *_slot; }
+
+		pointer	operator->() const { return _slot;	}
+
+//	Increment iterator position (pre-increment)
+		hash_iterator&	operator++ () { ++_ctrl; ++_slot; _skip(); return *this; }
+
+		hash_iterator operator++ (int) { hash_iterator tmp(*this);	operator++();	return tmp;	}
+
+		template <class U>
+		bool operator==(const hash_iterator<U>& rhs) const { return _ctrl == rhs._ctrl; }
+		template <class U>
+		bool operator!=(const hash_iterator<U>& rhs) const { return _ctrl != rhs._ctrl; }
+
+	private:
+		void _skip() {
+			while (*_ctrl < hash_ctrl::sentinel) {
+				++_ctrl;
+				++_slot;
+			}
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,392 @@
+#ifndef _HASH_TABLE_HPP_
+#define _HASH_TABLE_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include "pair.hpp"
+#include "hash_iterator.hpp"
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
+namespace ft {
+
+	/*-------------------*/
+ /**	HASH:GROUP:      */
+/*-------------------*/
+
+/**	@brief 16 control bytes read at once. Each query answers with a bit mask,
+ *	bit i set when byte i qualifies: with SSE2 one compare and one movemask
+ *	check all 16 slots of a group, otherwise a plain loop builds the mask. */
+	struct hash_group {
+
+		static const std::size_t	width = 16;
+
+#ifdef __SSE2__
+		__m128i		_ctrl;
+
+		explicit hash_group(const signed char* ctrl) : _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+	/** slots whose control byte is 'tag' */
+		unsigned match(signed char tag) const {
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), _ctrl));
+		}
+
+	/** empty or erased slots: the control bytes below the sentinel */
+		unsigned match_free() const {
+			return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(hash_ctrl::sentinel), _ctrl));
+		}
+#else
+		const signed char*	_ctrl;
+
+		explicit hash_group(const signed char* ctrl) : _ctrl(ctrl) {}
+
+		unsigned match(signed char tag) const {
+			unsigned mask = 0;
+			for (std::size_t i = 0; i < width; ++i)
+				mask |= unsigned(_ctrl[i] == tag) << i;
+			return mask;
+		}
+
+		unsigned match_free() const {
+			unsigned mask = 0;
+			for (std::size_t i = 0; i < width; ++i)
+				mask |= unsigned(_ctrl[i] < hash_ctrl::sentinel) << i;
+			return mask;
+		}
+#endif
+
+		unsigned match_empty() const { return match(hash_ctrl::empty); }
+
+		static std::size_t first(unsigned mask) { return __builtin_ctz(mask); }
+	};
+
+	/*-------------------*/
+ /**	HASH:TABLE:      */
+/*-------------------*/
+
+/**	@brief Open-addressing table behind ft::unordered_map and ft::unordered_set,
+ *	laid out as a Swiss table: elements sit directly in one slot array, and a
+ *	parallel array of one control byte per slot says which slots are full and
+ *	holds 7 bits of their hash. A lookup hashes once, takes a group of 16 slots
+ *	from the other bits and compares the 16 control bytes with the tag in one
+ *	go; only tag matches (1 in 128 by chance) compare keys. The search stops
+ *	at the first group with an empty slot, otherwise the next group is probed
+ *	(triangular steps, which visit every group).
+ *	The capacity is a power of two, 16 slots at least, and at most 7/8 of it
+ *	is used; erasing leaves a tombstone unless the group still has an empty
+ *	slot. When the table fills up it is rebuilt: at the same capacity if
+ *	tombstones are at least half the used slots, at twice it otherwise.
+ *	Rebuilding moves the elements and invalidates iterators; inserting
+ *	without a rebuild and erasing leave the other elements in place.
+ *	KeyOfValue gets the key out of a stored element. */
+	template <class Value, class Key, class KeyOfValue, class Hash, class Pred, class Alloc>
+	class hash_table {
+
+	public:
+		typedef Key																										key_type;
+		typedef Value																									value_type;
+		typedef Hash																									hasher;
+		typedef Pred																									key_equal;
+		typedef Alloc																									allocator_type;
+		typedef typename Alloc::template rebind<Value>::other						slot_allocator_type;
+		typedef typename Alloc::template rebind<signed char>::other				ctrl_allocator_type;
+		typedef ft::hash_iterator<Value>																iterator;
+		typedef ft::hash_iterator<const Value>													const_iterator;
+		typedef std::size_t																						size_type;
+
+	private:
+		signed char*					_ctrl;					// _capacity bytes and the sentinel
+		value_type*						_slots;
+		size_type							_capacity;
+		size_type							_size;
+		size_type							_growth_left;		// empty slots that may still be filled before a rebuild
+		Hash									_hash;
+		Pred									_eq;
+		slot_allocator_type		_alloc;
+
+	public:
+		explicit hash_table(size_type n, const Hash& hash, const Pred& eq, const Alloc& alloc) :
+		_ctrl(_empty_ctrl()), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+		_hash(hash), _eq(eq), _alloc(alloc) {
+			reserve(n);
+		}
+
+	/** same capacity and layout: the control bytes are copied as they are */
+		hash_table(const hash_table& x) :
+		_ctrl(_empty_ctrl()), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+		_hash(x._hash), _eq(x._eq), _alloc(x._alloc) {
+			_copy(x);
+		}
+
+		~hash_table() { _release(); }
+
+		hash_table& operator= (const hash_table& x) {
+			if (this == &x) return *this;
+			_release();
+			_hash = x._hash;
+			_eq = x._eq;
+			_copy(x);
+			return *this;
+		}
+
+		iterator begin() { return iterator(_ctrl, _slots); }
+		const_iterator begin() const { return const_iterator(_ctrl, _slots); }
+		iterator end() { return iterator(_ctrl + _capacity, _slots + _capacity); }
+		const_iterator end() const { return const_iterator(_ctrl + _capacity, _slots + _capacity); }
+		iterator at_index(size_type i) { return iterator(_ctrl + i, _slots + i); }
+		const_iterator at_index(size_type i) const { return const_iterator(_ctrl + i, _slots + i); }
+		size_type index_of(const_iterator it) const { return it._slot - _slots; }
+
+		bool empty() const { return _size == 0; }
+		size_type size() const { return _size; }
+		size_type max_size() const { return _alloc.max_size() / 2; }
+		size_type capacity() const { return _capacity; }
+		float load_factor() const { return _capacity ? float(_size) / _capacity : 0.0f; }
+		float max_load_factor() const { return 0.875f; }
+
+		hasher hash_function() const { return _hash; }
+		key_equal key_eq() const { return _eq; }
+		allocator_type get_allocator() const { return allocator_type(_alloc); }
+
+		value_type& slot(size_type i) { return _slots[i]; }
+		std::size_t hash(const key_type& k) const { return _hash(k); }
+
+	/** index of k's slot, capacity() (end) if k is not in the table */
+		size_type find(const key_type& k) const {
+			if (_size == 0)
+				return _capacity;
+			return _find(k, _hash(k));
+		}
+
+	/** @return: (index, true) if k is in the table, else (index, false) with
+	 *	a free slot for it on its probe path, the table grown if needed.
+	 *	'h' is hash(k); the slot must then be filled with construct(). */
+		ft::pair<size_type, bool> find_or_prepare(const key_type& k, std::size_t h) {
+			size_type		target = _capacity;
+			if (_capacity) {
+				size_type	mask = _capacity / hash_group::width - 1;
+				size_type	g = (h >> 7) & mask;
+				signed char	tag = static_cast<signed char>(h & 0x7f);
+				for (size_type step = 1; ; ++step) {
+					size_type		base = g * hash_group::width;
+					hash_group	group(_ctrl + base);
+					for (unsigned m = group.match(tag); m; m &= m - 1) {
+						size_type	i = base + hash_group::first(m);
+						if (_eq(KeyOfValue()(_slots[i]), k))
+							return ft::make_pair(i, true);
+					}
+					if (target == _capacity && group.match_free())
+						target = base + hash_group::first(group.match_free());
+					if (group.match_empty())
+						break;
+					g = (g + step) & mask;
+				}
+			}
+			if (target == _capacity || (_ctrl[target] == hash_ctrl::empty && _growth_left == 0)) {
+				_grow();
+				target = _find_free(h);
+			}
+			return ft::make_pair(target, false);
+		}
+
+	/** fills the slot handed out by find_or_prepare */
+		void construct(size_type i, std::size_t h, const value_type& val) {
+			_alloc.construct(_slots + i, val);
+			if (_ctrl[i] == hash_ctrl::empty)
+				--_growth_left;
+			_ctrl[i] = static_cast<signed char>(h & 0x7f);
+			++_size;
+		}
+
+		ft::pair<size_type, bool> insert(const value_type& val) {
+			std::size_t								h = _hash(KeyOfValue()(val));
+			ft::pair<size_type, bool>	r = find_or_prepare(KeyOfValue()(val), h);
+			if (!r.second)
+				construct(r.first, h, val);
+			return ft::make_pair(r.first, !r.second);
+		}
+
+	/** a slot whose group has an empty one ends every probe through it:
+	 *	it can be empty again. Otherwise it is left as a tombstone */
+		void erase(size_type i) {
+			_alloc.destroy(_slots + i);
+			if (hash_group(_ctrl + i / hash_group::width * hash_group::width).match_empty()) {
+				_ctrl[i] = hash_ctrl::empty;
+				++_growth_left;
+			}
+			else
+				_ctrl[i] = hash_ctrl::deleted;
+			--_size;
+		}
+
+	/** keeps the capacity; tombstones go too */
+		void clear() {
+			if (_size) {
+				for (size_type i = 0; i < _capacity; ++i)
+					if (_ctrl[i] >= 0)
+						_alloc.destroy(_slots + i);
+			}
+			if (_capacity) {
+				std::memset(_ctrl, hash_ctrl::empty, _capacity);
+				_growth_left = _max_fill(_capacity);
+			}
+			_size = 0;
+		}
+
+		void swap(hash_table& x) {
+			_swap(_ctrl, x._ctrl);
+			_swap(_slots, x._slots);
+			_swap(_capacity, x._capacity);
+			_swap(_size, x._size);
+			_swap(_growth_left, x._growth_left);
+			_swap(_hash, x._hash);
+			_swap(_eq, x._eq);
+			_swap(_alloc, x._alloc);
+		}
+
+	/** room for 'n' elements without a rebuild */
+		void reserve(size_type n) {
+			if (n > _size + _growth_left)
+				_resize(_capacity_for(n));
+		}
+
+	/** rebuilds with room for at least 'n' elements (and the current ones):
+	 *	drops the tombstones, and may shrink the table */
+		void rehash(size_type n) {
+			if (n < _size)
+				n = _size;
+			if (n == 0) {
+				_release();
+				return;
+			}
+			_resize(_capacity_for(n));
+		}
+
+	private:
+		static signed char* _empty_ctrl() {
+			static signed char	sentinel = hash_ctrl::sentinel;
+			return &sentinel;
+		}
+
+		template <class T>
+		static void _swap(T& a, T& b) { T tmp = a; a = b; b = tmp; }
+
+		static size_type _max_fill(size_type capacity) { return capacity - capacity / 8; }
+
+		static size_type _capacity_for(size_type n) {
+			size_type capacity = hash_group::width;
+			while (_max_fill(capacity) < n)
+				capacity *= 2;
+			return capacity;
+		}
+
+		size_type _find(const key_type& k, std::size_t h) const {
+			size_type		mask = _capacity / hash_group::width - 1;
+			size_type		g = (h >> 7) & mask;
+			signed char	tag = static_cast<signed char>(h & 0x7f);
+			for (size_type step = 1; ; ++step) {
+				size_type		base = g * hash_group::width;
+				hash_group	group(_ctrl + base);
+				for (unsigned m = group.match(tag); m; m &= m - 1) {
+					size_type	i = base + hash_group::first(m);
+					if (_eq(KeyOfValue()(_slots[i]), k))
+						return i;
+				}
+				if (group.match_empty())
+					return _capacity;
+				g = (g + step) & mask;
+			}
+		}
+
+	/** first empty or erased slot on the probe path of 'h' */
+		size_type _find_free(std::size_t h) const {
+			size_type		mask = _capacity / hash_group::width - 1;
+			size_type		g = (h >> 7) & mask;
+			for (size_type step = 1; ; ++step) {
+				unsigned	m = hash_group(_ctrl + g * hash_group::width).match_free();
+				if (m)
+					return g * hash_group::width + hash_group::first(m);
+				g = (g + step) & mask;
+			}
+		}
+
+	/** out of empty slots: tombstones are reclaimed in place of growing
+	 *	when they are at least half of the used slots */
+		void _grow() {
+			if (_capacity && _size <= _max_fill(_capacity) / 2)
+				_resize(_capacity);
+			else
+				_resize(_capacity ? _capacity * 2 : hash_group::width);
+		}
+
+	/** moves every element into new arrays of 'capacity' slots */
+		void _resize(size_type capacity) {
+			ctrl_allocator_type	ctrl_alloc(_alloc);
+			signed char*				ctrl = ctrl_alloc.allocate(capacity + 1);
+			value_type*					slots;
+			try {
+				slots = _alloc.allocate(capacity);
+			}
+			catch (...) {
+				ctrl_alloc.deallocate(ctrl, capacity + 1);
+				throw;
+			}
+			std::memset(ctrl, hash_ctrl::empty, capacity);
+			ctrl[capacity] = hash_ctrl::sentinel;
+
+			signed char*	old_ctrl = _ctrl;
+			value_type*		old_slots = _slots;
+			size_type			old_capacity = _capacity;
+			_ctrl = ctrl;
+			_slots = slots;
+			_capacity = capacity;
+			_growth_left = _max_fill(capacity) - _size;
+
+			for (size_type i = 0; i < old_capacity; ++i) {
+				if (old_ctrl[i] < 0)
+					continue;
+				std::size_t	h = _hash(KeyOfValue()(old_slots[i]));
+				size_type		to = _find_free(h);
+				_alloc.construct(_slots + to, old_slots[i]);
+				_ctrl[to] = static_cast<signed char>(h & 0x7f);
+				_alloc.destroy(old_slots + i);
+			}
+			if (old_capacity) {
+				ctrl_alloc.deallocate(old_ctrl, old_capacity + 1);
+				_alloc.deallocate(old_slots, old_capacity);
+			}
+		}
+
+		void _copy(const hash_table& x) {
+			if (x._capacity == 0)
+				return;
+			ctrl_allocator_type	ctrl_alloc(_alloc);
+			_ctrl = ctrl_alloc.allocate(x._capacity + 1);
+			_slots = _alloc.allocate(x._capacity);
+			std::memcpy(_ctrl, x._ctrl, x._capacity + 1);
+			_capacity = x._capacity;
+			_growth_left = x._growth_left;
+			for (size_type i = 0; i < _capacity; ++i)
+				if (_ctrl[i] >= 0) {
+					_alloc.construct(_slots + i, x._slots[i]);
+					++_size;
+				}
+		}
+
+		void _release() {
+			clear();
+			if (_capacity) {
+				ctrl_allocator_type(_alloc).deallocate(_ctrl, _capacity + 1);
+				_alloc.deallocate(_slots, _capacity);
+			}
+			_ctrl = _empty_ctrl();
+			_slots = NULL;
+			_capacity = 0;
+			_growth_left = 0;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef _INDEX_SORT_HPP_
+#define _INDEX_SORT_HPP_
+
+#include <cstddef>
+
+namespace ft {
+
+	/**	@index_sort: fills 'order' with the indices of 'keys' in stable sorted
+	 *	order: bottom-up merge sort on the indices, so no key is copied.
+	 *	'order' is any vector of indices, 'keys' anything indexable */
+	template <class Keys, class Order, class Compare>
+	void index_sort(const Keys& keys, std::size_t n, Order& order, Compare comp) {
+		typedef typename Order::value_type	index;
+
+		order.reserve(n);
+		for (std::size_t i = 0; i < n; ++i)
+			order.push_back(i);
+		Order		tmp(n);
+		index*	from = order.data();
+		index*	to = tmp.data();
+		for (std::size_t width = 1; width < n; width *= 2) {
+			for (std::size_t lo = 0; lo < n; lo += 2 * width) {
+				std::size_t mid = lo + width < n ? lo + width : n;
+				std::size_t hi = mid + width < n ? mid + width : n;
+				std::size_t a = lo;
+				std::size_t b = mid;
+				std::size_t out = lo;
+				while (a < mid && b < hi)
+					to[out++] = comp(keys[from[b]], keys[from[a]]) ? from[b++] : from[a++];
+				while (a < mid)
+					to[out++] = from[a++];
+				while (b < hi)
+					to[out++] = from[b++];
+			}
+			index* swap = from;
+			from = to;
+			to = swap;
+		}
+		if (from != order.data())
+			order.swap(tmp);
+	}
+
+	/**	@indirect_compare: 'Compare' on what two pointers point to, for
+	 *	index_sort over an array of pointers to the keys */
+	template <class Compare>
+	struct indirect_compare {
+		Compare	comp;
+
+		explicit indirect_compare(const Compare& c) : comp(c) {}
+		template <class T>
+		bool operator()(const T* a, const T* b) const { return comp(*a, *b); }
+	};
+
+}
+
+#endif
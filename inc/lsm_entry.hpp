@@ -0,0 +1,33 @@
+#ifndef _LSM_ENTRY_HPP_
+#define _LSM_ENTRY_HPP_
+
+#include "pair.hpp"
+
+namespace ft {
+
+	/*------------------*/
+ /**	LSM:ENTRY:      */
+/*------------------*/
+
+/**	@brief Record of ft::lsm_map: the last write of a key in a buffer or run,
+ *	either a value or, when _erased, a tombstone hiding the older writes of
+ *	the key. The key is not const, so that records can be sorted in place;
+ *	value() shows _data as the map's value_type, which has the same members
+ *	in the same order, and is all the iterators hand out. */
+	template <class Key, class T>
+	struct lsm_entry {
+
+		typedef ft::pair<Key, T>				data_type;
+		typedef ft::pair<const Key, T>	value_type;
+
+		data_type		_data;
+		bool				_erased;
+
+		lsm_entry() : _data(), _erased(false) {}
+		lsm_entry(const Key& key, const T& value, bool erased) : _data(key, value), _erased(erased) {}
+
+		const value_type&	value() const { return reinterpret_cast<const value_type&>(_data); }
+	};
+}
+
+#endif
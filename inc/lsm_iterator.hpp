@@ -0,0 +1,120 @@
+#ifndef LSM_ITERATOR_HPP
+#define LSM_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace ft
+{
+
+							/*----------------*/
+						 /** LSM:ITERATOR: */
+						/*----------------*/
+/**	@brief Forward iterator of ft::lsm_map: a merge of its sorted runs and
+ *	buffer, in key order. They are given oldest first, the buffer last;
+ *	where several hold a key, the
+ *	newest record wins and the others are stepped over, and a key whose
+ *	newest record is a tombstone is skipped altogether. Each step compares
+ *	the head of every run (an lsm_map keeps few of them). The cursors are
+ *	held in place, up to 'Cursors' of them, so that begin(), find() and the
+ *	bounds allocate nothing; empty runs are left out. Invalidated by any
+ *	write to the map. _top is npos at the end. */
+	template<class Entry, class Compare, std::size_t Cursors>
+	class lsm_iterator
+	{
+	public:
+
+		typedef typename Entry::value_type					value_type;
+		typedef const value_type&										reference;
+		typedef const value_type*										pointer;
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::forward_iterator_tag						iterator_category;
+
+		static const std::size_t	npos = static_cast<std::size_t>(-1);
+
+		struct cursor {
+			const Entry*	cur;
+			const Entry*	end;
+		};
+
+		cursor				_runs[Cursors];
+		std::size_t		_count;
+		std::size_t		_top;
+		Compare				_comp;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor: an end() with no run
+		lsm_iterator() : _count(0), _top(npos), _comp() {}
+
+		explicit lsm_iterator(const Compare& comp) : _count(0), _top(npos), _comp(comp) {}
+
+//	Copy constructor and assignment: only the cursors in use are copied
+		lsm_iterator(const lsm_iterator& x) : _count(x._count), _top(x._top), _comp(x._comp) {
+			for (std::size_t i = 0; i < _count; ++i)
+				_runs[i] = x._runs[i];
+		}
+
+		lsm_iterator&	operator= (const lsm_iterator& x) {
+			_count = x._count;
+			_top = x._top;
+			_comp = x._comp;
+			for (std::size_t i = 0; i < _count; ++i)
+				_runs[i] = x._runs[i];
+			return *this;
+		}
+
+	/** adds the next (newer) run; select() once they are all in */
+		void	push(const Entry* first, const Entry* last) {
+			if (first == last)
+				return;
+			cursor c = { first, last };
+			_runs[_count++] = c;
+		}
+
+	/** moves to the smallest key left whose newest record is a value */
+		void	select() {
+			while (true) {
+				_top = npos;
+				for (std::size_t i = 0; i < _count; ++i)
+					if (_runs[i].cur != _runs[i].end
+						&& (_top == npos || !_comp(_runs[_top].cur->_data.first, _runs[i].cur->_data.first)))
+						_top = i;
+				if (_top == npos || !_runs[_top].cur->_erased)
+					return;
+				_skip();
+			}
+		}
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return _runs[_top].cur->value(); }
+
+		pointer	operator->() const { return &(operator*());	}
+
+		lsm_iterator&	operator++ () {
+			_skip();
+			select();
+			return *this;
+		}
+
+		lsm_iterator operator++ (int) { lsm_iterator tmp(*this);	operator++();	return tmp;	}
+
+		bool operator==(const lsm_iterator& rhs) const {
+			if (_top == npos || rhs._top == npos)
+				return _top == rhs._top;
+			return _runs[_top].cur == rhs._runs[rhs._top].cur;
+		}
+		bool operator!=(const lsm_iterator& rhs) const { return !(*this == rhs); }
+
+	private:
+	/** moves every run past the current key, the run holding it last */
+		void	_skip() {
+			const Entry* top = _runs[_top].cur;
+			for (std::size_t i = 0; i < _count; ++i)
+				if (i != _top && _runs[i].cur != _runs[i].end && !_comp(top->_data.first, _runs[i].cur->_data.first))
+					++_runs[i].cur;
+			++_runs[_top].cur;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef MERGE_ITERATOR_HPP
+#define MERGE_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace ft
+{
+
+							/*------------------*/
+						 /** MERGE:ITERATOR: */
+						/*------------------*/
+/**	@brief Forward iterator over K sorted ranges with no key in common, in
+ *	key order: the k-way merge behind ft::sharded_map's ordered view.
+ *	Each step moves the range it was on forward and takes the smallest
+ *	head again, K - 1 key comparisons; for the handful of shards a map is
+ *	split into, that beats keeping a heap in order. _top is K at the end. */
+	template<class Iterator, class Compare, std::size_t K>
+	class merge_iterator
+	{
+	public:
+
+		typedef typename Iterator::value_type				value_type;
+		typedef typename Iterator::reference				reference;
+		typedef typename Iterator::pointer					pointer;
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::forward_iterator_tag						iterator_category;
+
+		Iterator		_cur[K];
+		Iterator		_end[K];
+		std::size_t	_top;
+		Compare			_comp;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor: an end() with no range
+		merge_iterator() : _top(K), _comp() {}
+
+		explicit merge_iterator(const Compare& comp) : _top(K), _comp(comp) {}
+
+	/** range 'i' of the merge; select() once they are all set */
+		void	set(std::size_t i, Iterator first, Iterator last) {
+			_cur[i] = first;
+			_end[i] = last;
+		}
+
+		void	select() {
+			_top = K;
+			for (std::size_t i = 0; i < K; ++i)
+				if (_cur[i] != _end[i] && (_top == K || _comp(_cur[i]->first, _cur[_top]->first)))
+					_top = i;
+		}
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return *_cur[_top]; }
+
+		pointer	operator->() const { return &(operator*());	}
+
+		merge_iterator&	operator++ () {
+			++_cur[_top];
+			select();
+			return *this;
+		}
+
+		merge_iterator operator++ (int) { merge_iterator tmp(*this);	operator++();	return tmp;	}
+
+		bool operator==(const merge_iterator& rhs) const {
+			return _top == rhs._top && (_top == K || _cur[_top] == rhs._cur[_top]);
+		}
+		bool operator!=(const merge_iterator& rhs) const { return !(*this == rhs); }
+	};
+}
+
+#endif
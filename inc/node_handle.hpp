@@ -0,0 +1,91 @@
+#ifndef _NODE_HANDLE_HPP_
+#define _NODE_HANDLE_HPP_
+
+#include <cstddef>
+#include "enable_if.hpp"
+
+namespace ft {
+
+	/*------------------*/
+ /**	NODE:HANDLE:   */
+/*------------------*/
+
+/**	@brief Owner of a node taken out of an ft::map by extract(): the element
+ *	stays where it was allocated, so handing it to another map's
+ *	insert(node_handle) only relinks it. There are no moves in C++98: like
+ *	std::auto_ptr, copying or assigning a handle passes the node on and
+ *	leaves the source empty, which is what lets extract() be returned by
+ *	value and passed straight to insert(). A handle still owning its node
+ *	destroys it with the allocator of the map it came from. */
+	template <class Node, class NodeAlloc>
+	class node_handle {
+
+	public:
+		typedef typename Node::value_type						value_type;
+		typedef typename ft::remove_const<typename value_type::first_type>::type		key_type;
+		typedef typename value_type::second_type		mapped_type;
+		typedef NodeAlloc														allocator_type;
+
+	private:
+		mutable Node*		_node;
+		allocator_type	_alloc;
+
+	public:
+		node_handle() : _node(NULL), _alloc() {}
+
+		node_handle(Node* node, const allocator_type& alloc) : _node(node), _alloc(alloc) {}
+
+	/** takes the node over from 'x' */
+		node_handle(const node_handle& x) : _node(x.release()), _alloc(x._alloc) {}
+
+		~node_handle() { _destroy(); }
+
+		node_handle& operator= (const node_handle& x) {
+			if (this != &x) {
+				_destroy();
+				_alloc = x._alloc;
+				_node = x.release();
+			}
+			return *this;
+		}
+
+		bool empty() const { return _node == NULL; }
+
+	/** the key may be changed before the node goes into another map */
+		key_type& key() const { return const_cast<key_type&>(_node->_data.first); }
+		mapped_type& mapped() const { return _node->_data.second; }
+		value_type& value() const { return _node->_data; }
+
+		allocator_type get_allocator() const { return _alloc; }
+
+	/** gives up the node without destroying it */
+		Node* release() const {
+			Node* node = _node;
+			_node = NULL;
+			return node;
+		}
+
+		void swap(node_handle& x) {
+			Node* node = _node;
+			_node = x._node;
+			x._node = node;
+			allocator_type alloc = _alloc;
+			_alloc = x._alloc;
+			x._alloc = alloc;
+		}
+
+	private:
+		void _destroy() {
+			if (_node == NULL)
+				return;
+			_alloc.destroy(_node);
+			_alloc.deallocate(_node, 1);
+			_node = NULL;
+		}
+	};
+
+	template <class Node, class NodeAlloc>
+	void swap(node_handle<Node, NodeAlloc>& lhs, node_handle<Node, NodeAlloc>& rhs) { lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef _NODE_POOL_ALLOCATOR_HPP_
+#define _NODE_POOL_ALLOCATOR_HPP_
+
+#include <memory>
+#include <new>
+#include <cstddef>
+
+namespace ft {
+
+	/*------------------------*/
+ /**	NODE:POOL:ALLOCATOR: */
+/*------------------------*/
+
+/**	the pools of one node_pool_allocator and of its copies and rebinds,
+ *	shared whatever the type they allocate */
+	struct node_pool_slab {
+		node_pool_slab*		next;
+		std::size_t				count;
+	};
+
+	struct node_pool {
+		std::size_t				size;					// bytes of a slot
+		node_pool*				next;					// the group's next pool
+		void*							free_list;
+		char*							cursor;				// next never used slot of the current slab
+		char*							limit;				// end of the current slab
+		node_pool_slab*		slabs;
+		std::size_t				capacity;			// slots owned by every slab
+		std::size_t				available;		// free list plus the untouched end of the slab
+	};
+
+	struct node_pool_group {
+		std::size_t				refs;
+		node_pool*				pools;
+	};
+
+/**	@brief Allocator for node based containers: single objects are handed out
+ *	from large slabs and given back to an intrusive free list, so insert/erase
+ *	churn never reaches the global heap and neighbouring nodes share pages.
+ *	Requests of more than one object go straight to operator new.
+ *	Copies and rebinds share one group of pools, one pool per slot size, and
+ *	compare equal: a map's node allocator draws from the pool of its node
+ *	size, and rebinding it back gives the allocator it was made from.
+ *	Slabs are only given back when the last allocator of the group goes away.
+ *	Not thread safe: a pool belongs to one container (or one thread). */
+	template <class T>
+	class node_pool_allocator {
+
+	public:
+		typedef T									value_type;
+		typedef T*								pointer;
+		typedef const T*					const_pointer;
+		typedef T&								reference;
+		typedef const T&					const_reference;
+		typedef std::size_t				size_type;
+		typedef std::ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind { typedef node_pool_allocator<U> other; };
+
+	private:
+	/** only gives a slot the strictest alignment; a free slot stores the
+	 *	next free slot in its first bytes */
+		union align {
+			long double	align_ld;
+			long long		align_ll;
+			void*				align_ptr;
+		};
+
+		typedef node_pool_slab		slab;
+		typedef node_pool					pool;
+		typedef node_pool_group		group;
+
+		group*	_group;
+		pool*		_pool;
+
+		static size_type slot_size() {
+			size_type size = sizeof(T) < sizeof(void*) ? sizeof(void*) : sizeof(T);
+			return ((size + sizeof(align) - 1) / sizeof(align)) * sizeof(align);
+		}
+
+		// slots begin after the slab header, rounded up to the alignment
+		static size_type slab_offset() {
+			return ((sizeof(slab) + sizeof(align) - 1) / sizeof(align)) * sizeof(align);
+		}
+
+		void add_slab(size_type count) {
+			slab* s = static_cast<slab*>(::operator new(slab_offset() + count * _pool->size));
+			s->next = _pool->slabs;
+			s->count = count;
+			_pool->slabs = s;
+
+		// what is left of the previous slab goes to the free list
+			for (; _pool->cursor != _pool->limit; _pool->cursor += _pool->size) {
+				*reinterpret_cast<void**>(_pool->cursor) = _pool->free_list;
+				_pool->free_list = _pool->cursor;
+			}
+			_pool->cursor = reinterpret_cast<char*>(s) + slab_offset();
+			_pool->limit = _pool->cursor + count * _pool->size;
+			_pool->capacity += count;
+			_pool->available += count;
+		}
+
+		void release() {
+			if (--_group->refs)
+				return;
+			while (_group->pools) {
+				pool* p = _group->pools;
+				while (p->slabs) {
+					slab* next = p->slabs->next;
+					::operator delete(p->slabs);
+					p->slabs = next;
+				}
+				_group->pools = p->next;
+				delete p;
+			}
+			delete _group;
+		}
+
+	/** the group's pool for slots of T, made if it has none yet */
+		static pool* pool_of(group* g) {
+			size_type size = slot_size();
+			for (pool* p = g->pools; p; p = p->next)
+				if (p->size == size)
+					return p;
+			pool* p = new pool;
+			p->size = size;
+			p->next = g->pools;
+			p->free_list = NULL;
+			p->cursor = NULL;
+			p->limit = NULL;
+			p->slabs = NULL;
+			p->capacity = 0;
+			p->available = 0;
+			g->pools = p;
+			return p;
+		}
+
+		static group* new_group() {
+			group* g = new group;
+			g->refs = 1;
+			g->pools = NULL;
+			return g;
+		}
+
+		template <class U> friend class node_pool_allocator;
+
+	public:
+	/** slabs grow with the pool: each new one doubles the capacity,
+	 *	starting at min_slab and never above max_slab slots */
+		static const size_type	min_slab = 64;
+		static const size_type	max_slab = 65536;
+
+/**	CONSTRUCTOR: 	*/
+		node_pool_allocator() : _group(new_group()), _pool(NULL) {
+			try {
+				_pool = pool_of(_group);
+			}
+			catch (...) {
+				delete _group;
+				throw;
+			}
+		}
+
+		node_pool_allocator(const node_pool_allocator& other) : _group(other._group), _pool(other._pool) { ++_group->refs; }
+
+		// rebinding: same group, the pool of this object size
+		template <class U>
+		node_pool_allocator(const node_pool_allocator<U>& other) : _group(other._group), _pool(pool_of(other._group)) {
+			++_group->refs;
+		}
+
+		~node_pool_allocator() { release(); }
+
+		node_pool_allocator& operator= (const node_pool_allocator& other) {
+			if (_group == other._group) return *this;
+			++other._group->refs;
+			release();
+			_group = other._group;
+			_pool = other._pool;
+			return *this;
+		}
+
+/**	ALLOCATION: 	*/
+		pointer allocate(size_type n, const void* = 0) {
+			if (n != 1)
+				return static_cast<pointer>(::operator new(n * sizeof(T)));
+			void* s = _pool->free_list;
+			if (s)
+				_pool->free_list = *static_cast<void**>(s);
+			else {
+				if (_pool->cursor == _pool->limit) {
+					size_type count = _pool->capacity ? _pool->capacity : size_type(min_slab);
+					add_slab(count < max_slab ? count : size_type(max_slab));
+				}
+				s = _pool->cursor;
+				_pool->cursor += _pool->size;
+			}
+			--_pool->available;
+			return static_cast<pointer>(s);
+		}
+
+		void deallocate(pointer p, size_type n) {
+			if (n != 1) {
+				::operator delete(p);
+				return;
+			}
+			*reinterpret_cast<void**>(p) = _pool->free_list;
+			_pool->free_list = p;
+			++_pool->available;
+		}
+
+	/** makes sure 'n' more objects can be handed out without touching the heap;
+	 *	the missing ones come in a single slab */
+		void reserve(size_type n) {
+			if (n > _pool->available)
+				add_slab(n - _pool->available);
+		}
+
+		size_type capacity() const { return _pool->capacity; }
+		size_type available() const { return _pool->available; }
+
+		void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) T(val); }
+		void destroy(pointer p) { p->~T(); }
+
+		pointer address(reference x) const { return &x; }
+		const_pointer address(const_reference x) const { return &x; }
+		size_type max_size() const { return size_type(-1) / sizeof(T); }
+
+		bool operator==(const node_pool_allocator& rhs) const { return _group == rhs._group; }
+		bool operator!=(const node_pool_allocator& rhs) const { return _group != rhs._group; }
+	};
+
+	/*----------------*/
+ /**	POOL:TRAITS: */
+/*----------------*/
+
+/**	@brief What a container may ask of its node allocator beyond the
+ *	std::allocator interface; plain allocators just ignore it.
+ *	@bulk_release: the allocator gives all its memory back at once, so
+ *	trivially destructible nodes can be dropped without visiting them */
+	template <class Alloc>
+	struct pool_traits {
+		static const bool bulk_release = false;
+		static void reserve(Alloc&, std::size_t) {}
+	};
+
+	template <class T>
+	struct pool_traits<node_pool_allocator<T> > {
+		static const bool bulk_release = false;
+		static void reserve(node_pool_allocator<T>& alloc, std::size_t n) { alloc.reserve(n); }
+	};
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef PERSISTENT_ITERATOR_HPP
+#define PERSISTENT_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace ft
+{
+
+							/*-----------------------*/
+						 /** PERSISTENT:ITERATOR: */
+						/*-----------------------*/
+/**	@brief Bidirectional iterator of ft::persistent_map. Shared nodes have no
+ *	parent pointer, so the iterator carries its own path from the root:
+ *	_path[0.._depth) with the current node on top, _depth 0 being end().
+ *	max_depth bounds the AVL height, which reaches 64 only past 10^13
+ *	elements. The iterator is valid as long as the version it came from is. */
+	template<class T, class Node>
+	class persistent_iterator
+	{
+	public:
+
+		typedef T																		value_type;
+		typedef const value_type&										reference;
+		typedef const value_type*										pointer;
+
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::bidirectional_iterator_tag			iterator_category;
+
+		static const int	max_depth = 64;
+
+		Node*		_root;
+		Node*		_path[max_depth];
+		int			_depth;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		persistent_iterator() : _root(NULL), _depth(0) {}
+
+//	Initialization constructor: end() of the version rooted at 'root'
+		explicit persistent_iterator(Node* root) : _root(root), _depth(0) {}
+
+		persistent_iterator(const persistent_iterator& x) : _root(x._root), _depth(x._depth) {
+			for (int i = 0; i < _depth; ++i)
+				_path[i] = x._path[i];
+		}
+
+		persistent_iterator& operator= (const persistent_iterator& x) {
+			_root = x._root;
+			_depth = x._depth;
+			for (int i = 0; i < _depth; ++i)
+				_path[i] = x._path[i];
+			return *this;
+		}
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return _path[_depth - 1]->_data; }
+
+		pointer	operator->() const { return &(operator*());	}
+
+		void	push(Node* node) { _path[_depth++] = node; }
+
+	/** down to the leftmost node under the right child, or up out of every
+	 *	right subtree we are the last of */
+		persistent_iterator&	operator++ () {
+			Node* node = _path[_depth - 1];
+			if (node->_right) {
+				push(node = node->_right);
+				while (node->_left)
+					push(node = node->_left);
+			}
+			else {
+				do
+					node = _path[--_depth];
+				while (_depth > 0 && _path[_depth - 1]->_right == node);
+			}
+			return *this;
+		}
+
+		persistent_iterator operator++ (int) { persistent_iterator tmp(*this);	operator++();	return tmp;	}
+
+	/** from end() onto the rightmost node, else the mirror of ++ */
+		persistent_iterator&	operator-- () {
+			Node* node = _depth ? _path[_depth - 1]->_left : _root;
+			if (node) {
+				push(node);
+				while (node->_right)
+					push(node = node->_right);
+			}
+			else {
+				do
+					node = _path[--_depth];
+				while (_depth > 0 && _path[_depth - 1]->_left == node);
+			}
+			return *this;
+		}
+
+		persistent_iterator operator-- (int) { persistent_iterator tmp(*this);	operator--();	return tmp;	}
+
+		bool operator==(const persistent_iterator& rhs) const {
+			return _depth == rhs._depth && (_depth == 0 || _path[_depth - 1] == rhs._path[_depth - 1]);
+		}
+		bool operator!=(const persistent_iterator& rhs) const { return !(*this == rhs); }
+	};
+}
+
+#endif
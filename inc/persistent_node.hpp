@@ -0,0 +1,36 @@
+#ifndef _PERSISTENT_NODE_HPP_
+#define _PERSISTENT_NODE_HPP_
+
+#include <cstddef>
+
+namespace ft {
+
+	/*----------------------*/
+ /**	PERSISTENT:NODE:    */
+/*----------------------*/
+
+/**	@brief Node of ft::persistent_map. Once linked into a version it never
+ *	changes again, apart from _refs: the number of parents and map versions
+ *	pointing at it, updated atomically so that versions held by other
+ *	threads can be let go of concurrently. A node has no parent pointer,
+ *	since it may have as many parents as there are versions sharing it. */
+	template <class T>
+	struct persistent_node {
+
+		typedef T								value_type;
+		typedef persistent_node*	Node;
+
+		value_type		_data;
+		Node					_left;
+		Node					_right;
+		int						_height;
+		volatile long	_refs;
+
+		persistent_node(const value_type& data, Node left, Node right) :
+		_data(data), _left(left), _right(right), _height(1 + (height(left) > height(right) ? height(left) : height(right))), _refs(1) {}
+
+		static int height(Node node) { return node ? node->_height : 0; }
+	};
+}
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef _PREFETCH_HPP_
+#define _PREFETCH_HPP_
+
+/**	@FT_PREFETCH: asks for the cache line at 'addr' ahead of its use;
+ *	compiled out where the builtin is missing */
+#if defined(__GNUC__) || defined(__clang__)
+# define FT_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+# define FT_PREFETCH(addr) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef PREFIX_ITERATOR_HPP
+#define PREFIX_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+#include <string>
+#include "pair.hpp"
+
+namespace ft
+{
+
+							/*--------------------*/
+						 /** PREFIX:ITERATOR: */
+						/*--------------------*/
+/**	@brief What a prefix_iterator points to: the key rebuilt in the
+ *	iterator, and the mapped value in the map. Reads like a
+ *	pair<const std::string, T> and converts to one. 'first' refers to the
+ *	iterator's key, valid while the iterator stays where it is; the
+ *	reverse iterator, which dereferences a temporary, holds a copy instead
+ *	(First = const std::string). */
+	template<class T, class First = const std::string&>
+	struct prefix_entry
+	{
+		First				first;
+		T&					second;
+
+		prefix_entry(const std::string& key, T& value) : first(key), second(value) {}
+
+		template <class U, class V>
+		operator ft::pair<U, V>() const { return ft::pair<U, V>(first, second); }
+	};
+
+	template <class T, class F, class U, class G>
+	bool operator==(const prefix_entry<T, F>& lhs, const prefix_entry<U, G>& rhs) {
+		return lhs.first == rhs.first && lhs.second == rhs.second; }
+
+	template <class T, class F, class U, class G>
+	bool operator!=(const prefix_entry<T, F>& lhs, const prefix_entry<U, G>& rhs) { return !(lhs == rhs); }
+
+	template <class T, class F, class U, class G>
+	bool operator<(const prefix_entry<T, F>& lhs, const prefix_entry<U, G>& rhs) {
+		return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second); }
+
+/**	@brief What operator-> of the prefix iterators returns: holds the entry
+ *	it points to */
+	template<class Entry>
+	struct prefix_arrow
+	{
+		Entry		_entry;
+
+		explicit prefix_arrow(const Entry& entry) : _entry(entry) {}
+		const Entry* operator->() const { return &_entry; }
+	};
+
+/**	@brief Bidirectional iterator of ft::prefix_map. Keys are not stored
+ *	whole, so the iterator keeps the key of its element, appending and
+ *	dropping labels as it moves along the tree: in order is depth first,
+ *	a node before its children. end() is a null node; stepping back from
+ *	it descends the last children from the map's root. */
+	template<class T, class Node>
+	class prefix_iterator
+	{
+	public:
+
+		typedef Node																node_type;
+		typedef T																		mapped_type;
+
+		typedef ft::pair<const std::string, T>			value_type;
+		typedef prefix_entry<T>											reference;
+		typedef prefix_arrow<reference>							pointer;
+
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::bidirectional_iterator_tag			iterator_category;
+
+		node_type*					_node;
+		node_type* const*		_root;
+		std::string					_key;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		prefix_iterator() : _node(NULL), _root(NULL) {}
+
+//	Initialization constructor
+		prefix_iterator(node_type* node, node_type* const* root, const std::string& key = std::string()) :
+		_node(node), _root(root), _key(key) {}
+
+		// Overload called when trying to copy construct a const_iterator
+		operator prefix_iterator<const T, Node>() const
+		{	return prefix_iterator<const T, Node>(_node, _root, _key); }
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return reference(_key, _node->value()); }
+
+		pointer	operator->() const { return pointer(operator*());	}
+
+//	Increment iterator position (pre-increment)
+		prefix_iterator&	operator++ () {
+			if (_node->_count) {
+				_node = _node->_children[0];
+				_key.append(_node->label(), _node->_len);
+				first_below();
+			}
+			else
+				skip();
+			return *this;
+		}
+
+		prefix_iterator operator++ (int) { prefix_iterator tmp(*this);	operator++();	return tmp;	}
+
+//	Decrement iterator position (pre-increment)
+		prefix_iterator&	operator-- () {
+			if (!_node) {
+				_node = *_root;
+				last_below();
+				return *this;
+			}
+			while (_node->_parent) {
+				node_type* parent = _node->_parent;
+				_key.resize(_key.size() - _node->_len);
+				std::size_t i = parent->index_of(_node);
+				if (i) {
+					_node = parent->_children[i - 1];
+					_key.append(_node->label(), _node->_len);
+					last_below();
+					return *this;
+				}
+				_node = parent;
+				if (_node->_valued)
+					break;
+			}
+			return *this;
+		}
+
+		prefix_iterator operator-- (int) { prefix_iterator tmp(*this);	operator--();	return tmp;	}
+
+		template <class U>
+		bool operator==(const prefix_iterator<U, Node>& rhs) const { return _node == rhs._node; }
+		template <class U>
+		bool operator!=(const prefix_iterator<U, Node>& rhs) const { return !(*this == rhs); }
+
+	/** moves to the first key below the current node, itself if it is one */
+		void first_below() {
+			while (!_node->_valued) {
+				_node = _node->_children[0];
+				_key.append(_node->label(), _node->_len);
+			}
+		}
+
+	/** moves past every key below the current node: to the first key of the
+	 *	next sibling of it or of its closest ancestor having one, or to end() */
+		void skip() {
+			while (_node->_parent) {
+				node_type* parent = _node->_parent;
+				std::size_t i = parent->index_of(_node) + 1;
+				_key.resize(_key.size() - _node->_len);
+				if (i < parent->_count) {
+					_node = parent->_children[i];
+					_key.append(_node->label(), _node->_len);
+					first_below();
+					return;
+				}
+				_node = parent;
+			}
+			_node = NULL;
+			_key.clear();
+		}
+
+	/** moves to the last key below the current node */
+		void last_below() {
+			while (_node->_count) {
+				_node = _node->_children[_node->_count - 1];
+				_key.append(_node->label(), _node->_len);
+			}
+		}
+	};
+
+/**	@brief Reverse iterator of ft::prefix_map: ft::reverse_iterator, but
+ *	for its reference. Dereferencing steps a copy of the base back and
+ *	reads that temporary, so the entry holds its own copy of the key. */
+	template<class Iterator>
+	class prefix_reverse_iterator
+	{
+	public:
+
+		typedef Iterator																				iterator_type;
+		typedef typename Iterator::value_type										value_type;
+		typedef prefix_entry<typename Iterator::mapped_type, const std::string>	reference;
+		typedef prefix_arrow<reference>													pointer;
+		typedef typename Iterator::difference_type							difference_type;
+		typedef typename Iterator::iterator_category						iterator_category;
+
+	protected:
+		iterator_type	_rev_it;
+
+	public:
+
+/** MEMBER:FUNCTIONS: */
+		prefix_reverse_iterator() : _rev_it() {}
+
+		explicit prefix_reverse_iterator(iterator_type it) : _rev_it(it) {}
+
+		template <class Iter>
+		prefix_reverse_iterator(const prefix_reverse_iterator<Iter>& rev_it) : _rev_it(rev_it.base()) {}
+
+		iterator_type	base() const { return _rev_it; }
+
+		reference	operator*() const {
+			iterator_type	it = _rev_it;
+			--it;
+			return reference(it._key, it._node->value());
+		}
+
+		pointer	operator->() const { return pointer(operator*()); }
+
+		prefix_reverse_iterator&	operator++ () { --_rev_it; return *this; }
+		prefix_reverse_iterator	operator++ (int) { prefix_reverse_iterator tmp(*this); --_rev_it; return tmp; }
+		prefix_reverse_iterator&	operator-- () { ++_rev_it; return *this; }
+		prefix_reverse_iterator	operator-- (int) { prefix_reverse_iterator tmp(*this); ++_rev_it; return tmp; }
+
+		template <class Iter>
+		bool operator==(const prefix_reverse_iterator<Iter>& rhs) const { return _rev_it == rhs.base(); }
+		template <class Iter>
+		bool operator!=(const prefix_reverse_iterator<Iter>& rhs) const { return !(*this == rhs); }
+	};
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef _PREFIX_NODE_HPP_
+#define _PREFIX_NODE_HPP_
+
+#include <cstddef>
+
+namespace ft {
+
+	template <class T>
+	struct prefix_leaf;
+
+	/*------------------*/
+ /**	PREFIX:NODES:   */
+/*------------------*/
+
+/**	@brief Node of ft::prefix_map: the edge from its parent is labelled
+ *	with the bytes stored right after the node, so a key is the labels on
+ *	the path from the root and bytes shared by several keys are stored
+ *	once. The children are an array of pointers followed by the first byte
+ *	of each one's label, sorted and distinct, allocated apart so that it
+ *	grows without moving the node. A node where a key ends is a
+ *	prefix_leaf, holding the mapped value before the label; any other node
+ *	but the root has at least two children. A split drops the first bytes
+ *	of a label without moving the node: they stay allocated, _skip of them. */
+	template <class T>
+	struct prefix_node {
+
+		prefix_node*		_parent;
+		prefix_node**		_children;	// _capacity pointers, then as many bytes
+		unsigned int		_len;				// bytes in the label
+		unsigned int		_skip;			// label bytes dropped from the front
+		unsigned short	_count;
+		unsigned short	_capacity;
+		bool						_valued;		// a key ends here: the node is a prefix_leaf
+
+	/** bytes of a node with a label of 'len' bytes */
+		static std::size_t bytes(std::size_t len, bool valued) {
+			return (valued ? sizeof(prefix_leaf<T>) : sizeof(prefix_node)) + len;
+		}
+
+		std::size_t bytes() const { return bytes(_skip + _len, _valued); }
+
+	/** bytes of a child array for 'capacity' children */
+		static std::size_t array_bytes(std::size_t capacity) { return capacity * (sizeof(prefix_node*) + 1); }
+
+		const char* label() const {
+			return reinterpret_cast<const char*>(this) + bytes(_skip, _valued);
+		}
+
+		unsigned char first() const { return *label(); }
+
+		T& value() { return static_cast<prefix_leaf<T>*>(this)->_value; }
+
+		const unsigned char* keys() const { return reinterpret_cast<const unsigned char*>(_children + _capacity); }
+		unsigned char* keys() { return reinterpret_cast<unsigned char*>(_children + _capacity); }
+
+	/** index of the first child whose label starts with 'b' or above */
+		std::size_t index(unsigned char b) const {
+			const unsigned char* k = keys();
+			std::size_t i = 0;
+			while (i < _count && k[i] < b)
+				++i;
+			return i;
+		}
+
+	/** the child whose label starts with 'b', or NULL */
+		prefix_node* find_child(unsigned char b) const {
+			std::size_t i = index(b);
+			return i < _count && keys()[i] == b ? _children[i] : NULL;
+		}
+
+	/** index of 'child' among the children */
+		std::size_t index_of(const prefix_node* child) const { return index(child->first()); }
+
+	/** the node must have room for it */
+		void insert_child(std::size_t i, prefix_node* child) {
+			unsigned char* k = keys();
+			for (std::size_t j = _count; j > i; --j) {
+				_children[j] = _children[j - 1];
+				k[j] = k[j - 1];
+			}
+			_children[i] = child;
+			k[i] = child->first();
+			++_count;
+		}
+
+		void remove_child(std::size_t i) {
+			unsigned char* k = keys();
+			for (--_count; i < _count; ++i) {
+				_children[i] = _children[i + 1];
+				k[i] = k[i + 1];
+			}
+		}
+
+	/** how many of the label's first 'n' bytes are those of 'key' */
+		std::size_t mismatch(const char* key, std::size_t n) const {
+			const char* l = label();
+			std::size_t i = 0;
+			if (n > _len)
+				n = _len;
+			while (i < n && l[i] == key[i])
+				++i;
+			return i;
+		}
+	};
+
+	template <class T>
+	struct prefix_leaf : public prefix_node<T> {
+		T		_value;
+	};
+}
+
+#endif
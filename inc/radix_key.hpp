@@ -0,0 +1,73 @@
+#ifndef _RADIX_KEY_HPP_
+#define _RADIX_KEY_HPP_
+
+#include <cstddef>
+#include <string>
+
+namespace ft {
+
+	/*-----------------*/
+ /**	RADIX:KEYS:    */
+/*-----------------*/
+
+/**	@brief How a radix tree (ft::art_map) reads a key: as a string of bytes
+ *	whose lexicographic order (unsigned bytes) is the order of the keys.
+ *	@size: bytes in the key; byte(k, i) for i >= size(k) is 0.
+ *	@prefix_size: bytes a prefix scan by 'k' matches on.
+ *	Integers are read most significant byte first, the sign bit of signed
+ *	ones flipped so that negatives come first. A std::string is its bytes
+ *	followed by a 0 byte, which ends it before any longer string sharing
+ *	its bytes. So a string holding '\0' may read as the bytes of another
+ *	("a\0" as "a" and its end): art_map::insert() throws for such a pair.
+ *	There is no generic version: other key types need a specialisation. */
+	template <class Key>
+	struct radix_key;
+
+#define FT_UNSIGNED_RADIX_KEY(T)																															\
+	template <>																																							\
+	struct radix_key<T> {																																		\
+		static std::size_t size(const T&) { return sizeof(T); }																\
+		static std::size_t prefix_size(const T&) { return sizeof(T); }												\
+		static unsigned char byte(const T& k, std::size_t i) {																\
+			return i < sizeof(T) ? static_cast<unsigned char>(k >> (8 * (sizeof(T) - 1 - i))) : 0;	\
+		}																																											\
+	};
+
+#define FT_SIGNED_RADIX_KEY(T, U)																																\
+	template <>																																							\
+	struct radix_key<T> {																																		\
+		static std::size_t size(const T&) { return sizeof(T); }																\
+		static std::size_t prefix_size(const T&) { return sizeof(T); }												\
+		static unsigned char byte(const T& k, std::size_t i) {																\
+			return radix_key<U>::byte(static_cast<U>(static_cast<U>(k) ^ (static_cast<U>(1) << (8 * sizeof(T) - 1))), i);	\
+		}																																											\
+	};
+
+	FT_UNSIGNED_RADIX_KEY(unsigned char)
+	FT_UNSIGNED_RADIX_KEY(unsigned short)
+	FT_UNSIGNED_RADIX_KEY(unsigned int)
+	FT_UNSIGNED_RADIX_KEY(unsigned long)
+	FT_UNSIGNED_RADIX_KEY(unsigned long long)
+	FT_SIGNED_RADIX_KEY(signed char, unsigned char)
+	FT_SIGNED_RADIX_KEY(short, unsigned short)
+	FT_SIGNED_RADIX_KEY(int, unsigned int)
+	FT_SIGNED_RADIX_KEY(long, unsigned long)
+	FT_SIGNED_RADIX_KEY(long long, unsigned long long)
+
+#undef FT_UNSIGNED_RADIX_KEY
+#undef FT_SIGNED_RADIX_KEY
+
+	template <>
+	struct radix_key<std::string> {
+		static std::size_t size(const std::string& k) { return k.size() + 1; }
+		static std::size_t prefix_size(const std::string& k) { return k.size(); }
+		static unsigned char byte(const std::string& k, std::size_t i) {
+			return i < k.size() ? static_cast<unsigned char>(k[i]) : 0;
+		}
+	};
+
+	template <class Key>
+	struct radix_key<const Key> : public radix_key<Key> {};
+}
+
+#endif
@@ -6,6 +6,14 @@ namespace ft {
 							/*--------------------*/
 						 /** REVERSE:ITERATOR: */
 						/*--------------------*/
+/**	What operator-> of an iterator returns: a raw pointer is that already,
+ *	an iterator class may return a proxy (ft::flat_map, ft::prefix_map) */
+template <typename T>
+T*	arrow_of(T* it) { return it; }
+
+template <typename Iterator>
+typename Iterator::pointer	arrow_of(const Iterator& it) { return it.operator->(); }
+
 template <typename iterator_type>
 class	reverse_iterator: public iterator_traits<iterator_type> {
 
@@ -79,7 +87,7 @@ class	reverse_iterator: public iterator_traits<iterator_type> {
 		reverse_iterator&	operator-= (difference_type n) { _rev_it += n; return *this; }
 
 //	Deference iterator - Returns a pointer to the element pointed to by the iterator
-		pointer	operator->() const { return &(operator*()); }
+		pointer	operator->() const { iterator_type	it = _rev_it; return arrow_of(--it); }
 		
 /**	Deference iterator with offset
  * 	Accesses the element located n positions away from the element currently pointed to.
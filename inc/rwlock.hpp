@@ -0,0 +1,61 @@
+#ifndef _RWLOCK_HPP_
+#define _RWLOCK_HPP_
+
+#include <pthread.h>
+
+namespace ft {
+
+	/*-------------*/
+ /**	RWLOCK:   */
+/*-------------*/
+
+/**	@brief Reader-writer lock over pthread_rwlock_t: any number of readers
+ *	or a single writer. Neither copyable nor assignable. */
+	class rwlock {
+
+		public:
+			rwlock() { pthread_rwlock_init(&_lock, NULL); }
+			~rwlock() { pthread_rwlock_destroy(&_lock); }
+
+			void lock_shared() { pthread_rwlock_rdlock(&_lock); }
+			void unlock_shared() { pthread_rwlock_unlock(&_lock); }
+			void lock() { pthread_rwlock_wrlock(&_lock); }
+			void unlock() { pthread_rwlock_unlock(&_lock); }
+
+		private:
+			pthread_rwlock_t	_lock;
+
+			rwlock(const rwlock&);
+			rwlock& operator= (const rwlock&);
+	};
+
+/**	@brief Holds 'lock' for reading from construction to destruction */
+	class read_guard {
+
+		public:
+			explicit read_guard(rwlock& lock) : _lock(lock) { _lock.lock_shared(); }
+			~read_guard() { _lock.unlock_shared(); }
+
+		private:
+			rwlock&	_lock;
+
+			read_guard(const read_guard&);
+			read_guard& operator= (const read_guard&);
+	};
+
+/**	@brief Holds 'lock' for writing from construction to destruction */
+	class write_guard {
+
+		public:
+			explicit write_guard(rwlock& lock) : _lock(lock) { _lock.lock(); }
+			~write_guard() { _lock.unlock(); }
+
+		private:
+			rwlock&	_lock;
+
+			write_guard(const write_guard&);
+			write_guard& operator= (const write_guard&);
+	};
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef SKIPLIST_ITERATOR_HPP
+#define SKIPLIST_ITERATOR_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace ft
+{
+
+							/*---------------------*/
+						 /** SKIPLIST:ITERATOR: */
+						/*---------------------*/
+/**	@brief Forward iterator of ft::concurrent_skiplist_map: a node, NULL at
+ *	the end. ++ follows level 0 past erased elements, so it sees every
+ *	element that stays in the map while it walks, plus maybe some of those
+ *	inserted or erased meanwhile. The node stays readable while the thread
+ *	holds the map's guard. */
+	template<class T, class Node>
+	class skiplist_iterator
+	{
+	public:
+
+		typedef T																		value_type;
+		typedef const value_type&										reference;
+		typedef const value_type*										pointer;
+
+		typedef std::ptrdiff_t											difference_type;
+		typedef std::forward_iterator_tag						iterator_category;
+
+		Node*		_node;
+
+/** MEMBER:FUNCTIONS: */
+//	Default constructor
+		skiplist_iterator() : _node(NULL) {}
+
+//	Initialization constructor
+		explicit skiplist_iterator(Node* node) : _node(node) {}
+
+//	Deference iterator:	Returns a reference to the element pointed to by the iterator
+		reference	operator*() const { return _node->_data; }
+
+		pointer	operator->() const { return &(operator*());	}
+
+		skiplist_iterator&	operator++ () {
+			_node = _node->live_next();
+			return *this;
+		}
+
+		skiplist_iterator operator++ (int) { skiplist_iterator tmp(*this);	operator++();	return tmp;	}
+
+		bool operator==(const skiplist_iterator& rhs) const { return _node == rhs._node; }
+		bool operator!=(const skiplist_iterator& rhs) const { return _node != rhs._node; }
+	};
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef _SKIPLIST_NODE_HPP_
+#define _SKIPLIST_NODE_HPP_
+
+#include <cstddef>
+#include "atomic.hpp"
+
+namespace ft {
+
+	/*--------------------*/
+ /**	SKIPLIST:NODE:    */
+/*--------------------*/
+
+/**	@brief Tower of ft::concurrent_skiplist_map: the element and one link per
+ *	level, allocated together (the array runs past the end of the struct).
+ *	A link with its low bit set is marked: the node is being erased and
+ *	nothing may be linked after it on that level; the mark on level 0 is
+ *	what erases the element. _linked is set once the inserter is done with
+ *	the upper levels, the eraser waits for it before marking them.
+ *	The map's head is a tower of max_height levels whose _data is never
+ *	constructed. */
+	template <class T>
+	struct skiplist_node {
+
+		typedef T									value_type;
+		typedef skiplist_node*		Node;
+
+		static const int	max_height = 32;
+
+		value_type				_data;
+		int								_height;
+		volatile long			_linked;
+		Node volatile			_next[1];
+
+	/** bytes for a tower of 'height' levels */
+		static std::size_t bytes(int height) { return sizeof(skiplist_node) + (height - 1) * sizeof(Node); }
+
+		static bool marked(Node link) { return reinterpret_cast<std::size_t>(link) & 1; }
+		static Node mark(Node link) { return reinterpret_cast<Node>(reinterpret_cast<std::size_t>(link) | 1); }
+		static Node unmark(Node link) { return reinterpret_cast<Node>(reinterpret_cast<std::size_t>(link) & ~std::size_t(1)); }
+
+		Node next(int level) const { return ft::atomic_load(&_next[level]); }
+
+	/** first node after this one on level 0 whose element is not erased */
+		Node live_next() const {
+			Node node = unmark(next(0));
+			while (node && marked(node->next(0)))
+				node = unmark(node->next(0));
+			return node;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef _STRING_VIEW_HPP_
+#define _STRING_VIEW_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace ft {
+
+	/*-------------------*/
+ /**	STRING:VIEW:    */
+/*-------------------*/
+
+/**	@brief Characters owned by someone else, with their length: the C++98
+ *	stand-in for std::string_view, as a lookup key for string-keyed
+ *	containers with ft::transparent_less. Unlike a const char*, which
+ *	std::string::compare measures again at each comparison, the length is
+ *	taken once, and unlike a std::string nothing is allocated. */
+	class string_view {
+
+	public:
+		typedef std::size_t		size_type;
+
+	private:
+		const char*	_data;
+		size_type		_size;
+
+	public:
+		string_view() : _data(""), _size(0) {}
+		string_view(const char* s) : _data(s), _size(std::strlen(s)) {}
+		string_view(const char* s, size_type n) : _data(s), _size(n) {}
+		string_view(const std::string& s) : _data(s.data()), _size(s.size()) {}
+
+		const char* data() const { return _data; }
+		size_type size() const { return _size; }
+		bool empty() const { return _size == 0; }
+
+		std::string str() const { return std::string(_data, _size); }
+		operator std::string() const { return str(); }
+
+	/** <0, 0 or >0 like std::string::compare */
+		int compare(const string_view& x) const {
+			int r = std::memcmp(_data, x._data, _size < x._size ? _size : x._size);
+			if (r != 0)
+				return r;
+			return _size < x._size ? -1 : _size > x._size;
+		}
+	};
+
+	inline bool operator < (const string_view& lhs, const string_view& rhs) { return lhs.compare(rhs) < 0; }
+	inline bool operator < (const string_view& lhs, const std::string& rhs) { return lhs.compare(rhs) < 0; }
+	inline bool operator < (const std::string& lhs, const string_view& rhs) { return string_view(lhs).compare(rhs) < 0; }
+
+	inline bool operator == (const string_view& lhs, const string_view& rhs) {
+		return lhs.size() == rhs.size() && lhs.compare(rhs) == 0; }
+
+/**	ft::three_way (see compare.hpp) for views against views and strings */
+	inline int three_way(const string_view& a, const string_view& b) { return a.compare(b); }
+	inline int three_way(const string_view& a, const std::string& b) { return a.compare(b); }
+	inline int three_way(const std::string& a, const string_view& b) { return string_view(a).compare(b); }
+}
+
+#endif
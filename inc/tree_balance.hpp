@@ -0,0 +1,387 @@
+#ifndef _TREE_BALANCE_HPP_
+#define _TREE_BALANCE_HPP_
+
+#include <cstddef>
+
+namespace ft {
+
+	/*--------------------*/
+ /**	TREE:ROTATIONS:  */
+/*--------------------*/
+
+/**	@brief Link surgery shared by the balancing policies. Nodes are TNode
+ *	pointers; the root hangs from the header (its _parent). A rotation
+ *	changes the subtrees of the two nodes it moves, so it first has them push
+ *	what they owe their children, and then pulls their augmented data
+ *	(see tree_augment.hpp), the lower one first. */
+	struct tree_rotation {
+
+	/** points the link that held 'node' (parent child or root) at 'child' */
+		template <class Node>
+		static void replace(Node node, Node child, Node header) {
+			if (node->_parent == header)
+				header->_parent = child;
+			else if (node->_parent->_left == node)
+				node->_parent->_left = child;
+			else
+				node->_parent->_right = child;
+			if (child)
+				child->_parent = node->_parent;
+		}
+
+	/** refreshes the augmented data from 'node' up to the root */
+		template <class Node>
+		static void pull_path(Node node, Node header) {
+			for (; node != header; node = node->_parent)
+				node->pull();
+		}
+
+	/** hangs 'child' (maybe NULL) under 'node' */
+		template <class Node>
+		static void link(Node node, Node child, bool left) {
+			(left ? node->_left : node->_right) = child;
+			if (child)
+				child->_parent = node;
+		}
+
+	/** the right child of 'node' takes its place; returns it */
+		template <class Node>
+		static Node rotate_left(Node node, Node header) {
+			Node root = node->_right;
+			node->push();
+			root->push();
+			node->_right = root->_left;
+			if (root->_left)
+				root->_left->_parent = node;
+			replace(node, root, header);
+			root->_left = node;
+			node->_parent = root;
+			node->pull();
+			root->pull();
+			return root;
+		}
+
+	/** the left child of 'node' takes its place; returns it */
+		template <class Node>
+		static Node rotate_right(Node node, Node header) {
+			Node root = node->_left;
+			node->push();
+			root->push();
+			node->_left = root->_right;
+			if (root->_right)
+				root->_right->_parent = node;
+			replace(node, root, header);
+			root->_right = node;
+			node->_parent = root;
+			node->pull();
+			root->pull();
+			return root;
+		}
+	};
+
+	/*---------------*/
+ /**	AVL:BALANCE: */
+/*---------------*/
+
+/**	@brief Strict balance: sibling subtrees differ in height by one at most,
+ *	so lookups walk the shortest paths. _height is the subtree height.
+ *	Retracing stops at the first subtree whose height did not change;
+ *	an erase may still rotate at every level up to the root. */
+	struct avl_balance {
+
+		static const int	leaf = 1;		// _height of a new node
+
+	/** 'node' was just hung as a leaf */
+		template <class Node>
+		static void inserted(Node node, Node header) { retrace(node->_parent, header); }
+
+	/** a node was unlinked below 'parent'; 'child' took its place */
+		template <class Node>
+		static void erased(Node, Node parent, int, Node header) { retrace(parent, header); }
+
+		template <class Node>
+		static int height(Node node) { return node == NULL ? 0 : node->_height; }
+
+		template <class Node>
+		static void update_height(Node node) {
+			int left = height(node->_left);
+			int right = height(node->_right);
+			node->_height = (left > right ? left : right) + 1;
+		}
+
+		template <class Node>
+		static int balance(Node node) { return height(node->_left) - height(node->_right); }
+
+		template <class Node>
+		static Node rotate_left(Node node, Node header) {
+			Node root = tree_rotation::rotate_left(node, header);
+			update_height(node);
+			update_height(root);
+			return root;
+		}
+
+		template <class Node>
+		static Node rotate_right(Node node, Node header) {
+			Node root = tree_rotation::rotate_right(node, header);
+			update_height(node);
+			update_height(root);
+			return root;
+		}
+
+	/** @brief Joins two detached trees and a node whose key lies between
+	 *	theirs into one tree, rooted under 'header' (which only serves as
+	 *	the parent of the root): 'mid' goes down the spine of the taller tree
+	 *	to a subtree as tall as the other tree, takes both as children and
+	 *	the path above retraces. O(difference in height). */
+		template <class Node>
+		static Node join(Node left, Node mid, Node right, Node header) {
+			int hl = height(left);
+			int hr = height(right);
+			bool taller_left = hl > hr + 1;
+			Node tall = taller_left ? left : right;
+			Node parent = header;
+
+			if (hl > hr + 1 || hr > hl + 1) {
+				int low = taller_left ? hr : hl;
+				header->_parent = tall;
+				tall->_parent = header;
+				while (height(tall) > low + 1) {
+					tall->push();
+					parent = tall;
+					tall = taller_left ? tall->_right : tall->_left;
+				}
+				if (taller_left)
+					left = tall;
+				else
+					right = tall;
+			}
+			tree_rotation::link(mid, left, true);
+			tree_rotation::link(mid, right, false);
+			update_height(mid);
+			if (parent == header) {
+				header->_parent = mid;
+				mid->_parent = header;
+			}
+			else
+				tree_rotation::link(parent, mid, !taller_left);
+			tree_rotation::pull_path(mid, header);
+			retrace(parent, header);
+			return header->_parent;
+		}
+
+	/** the root of a tree out of a split is already a valid AVL root */
+		template <class Node>
+		static void make_root(Node) {}
+
+	/** walks up from 'node' rotating where a subtree leans by two */
+		template <class Node>
+		static void retrace(Node node, Node header) {
+			while (node != header) {
+				int old_height = node->_height;
+				int bf = balance(node);
+
+				if (bf > 1) {
+					if (balance(node->_left) < 0)
+						rotate_left(node->_left, header);
+					node = rotate_right(node, header);
+				}
+				else if (bf < -1) {
+					if (balance(node->_right) > 0)
+						rotate_right(node->_right, header);
+					node = rotate_left(node, header);
+				}
+				else
+					update_height(node);
+				if (node->_height == old_height)
+					return;
+				node = node->_parent;
+			}
+		}
+	};
+
+	/*---------------------*/
+ /**	RED:BLACK:BALANCE: */
+/*---------------------*/
+
+/**	@brief Looser balance for write-heavy tables: no red node has a red child
+ *	and every path down holds the same number of black nodes, so the tree
+ *	stays within twice the optimal height. An insert rotates at most twice
+ *	and an erase at most three times; the rest is recolouring.
+ *	_height holds the colour (the header keeps its -1). */
+	struct red_black_balance {
+
+		static const int	red = 0;
+		static const int	black = 1;
+		static const int	leaf = red;
+
+		template <class Node>
+		static bool is_black(Node node) { return node == NULL || node->_height == black; }
+
+		template <class Node>
+		static void inserted(Node node, Node header) {
+			while (node != header->_parent && node->_parent->_height == red) {
+				Node parent = node->_parent;
+				Node grand = parent->_parent;		// a red parent is never the root
+
+				if (parent == grand->_left) {
+					Node uncle = grand->_right;
+					if (!is_black(uncle)) {
+						parent->_height = black;
+						uncle->_height = black;
+						grand->_height = red;
+						node = grand;
+						continue;
+					}
+					if (node == parent->_right) {
+						node = parent;
+						parent = tree_rotation::rotate_left(node, header);
+					}
+					parent->_height = black;
+					grand->_height = red;
+					tree_rotation::rotate_right(grand, header);
+				}
+				else {
+					Node uncle = grand->_left;
+					if (!is_black(uncle)) {
+						parent->_height = black;
+						uncle->_height = black;
+						grand->_height = red;
+						node = grand;
+						continue;
+					}
+					if (node == parent->_left) {
+						node = parent;
+						parent = tree_rotation::rotate_right(node, header);
+					}
+					parent->_height = black;
+					grand->_height = red;
+					tree_rotation::rotate_left(grand, header);
+				}
+			}
+			header->_parent->_height = black;
+		}
+
+	/** black nodes on a path down from 'node' (all paths have as many) */
+		template <class Node>
+		static int black_height(Node node) {
+			int bh = 0;
+			for (; node != NULL; node = node->_left)
+				bh += node->_height == black;
+			return bh;
+		}
+
+		template <class Node>
+		static void make_root(Node node) {
+			if (node)
+				node->_height = black;
+		}
+
+	/** @brief Joins two detached trees and a node whose key lies between
+	 *	theirs, as avl_balance::join: both roots are made black, then 'mid'
+	 *	goes down the spine of the tree with more black nodes to a black
+	 *	subtree with as many as the other tree, joins them as a red node and
+	 *	the insert fixup clears a red parent. Counting the black heights
+	 *	walks both trees down: O(log n). */
+		template <class Node>
+		static Node join(Node left, Node mid, Node right, Node header) {
+			make_root(left);
+			make_root(right);
+			int bl = black_height(left);
+			int br = black_height(right);
+
+			if (bl == br) {
+				tree_rotation::link(mid, left, true);
+				tree_rotation::link(mid, right, false);
+				mid->_height = black;
+				header->_parent = mid;
+				mid->_parent = header;
+				mid->pull();
+				return mid;
+			}
+			bool taller_left = bl > br;
+			Node tall = taller_left ? left : right;
+			int bh = taller_left ? bl : br;
+			int low = taller_left ? br : bl;
+			Node parent = header;
+
+			header->_parent = tall;
+			tall->_parent = header;
+			while (!(is_black(tall) && bh == low)) {
+				tall->push();
+				parent = tall;
+				bh -= tall->_height == black;
+				tall = taller_left ? tall->_right : tall->_left;
+			}
+			tree_rotation::link(mid, taller_left ? tall : left, true);
+			tree_rotation::link(mid, taller_left ? right : tall, false);
+			mid->_height = red;
+			tree_rotation::link(parent, mid, !taller_left);
+			tree_rotation::pull_path(mid, header);
+			inserted(mid, header);
+			return header->_parent;
+		}
+
+	/** 'removed' is the colour taken out of the tree: when black, the
+	 *	path through 'child' (maybe NULL, under 'parent') is one black short */
+		template <class Node>
+		static void erased(Node child, Node parent, int removed, Node header) {
+			if (removed != black)
+				return;
+			while (child != header->_parent && is_black(child)) {
+				if (child == parent->_left) {
+					Node sibling = parent->_right;
+					if (sibling->_height == red) {
+						sibling->_height = black;
+						parent->_height = red;
+						tree_rotation::rotate_left(parent, header);
+						sibling = parent->_right;
+					}
+					if (is_black(sibling->_left) && is_black(sibling->_right)) {
+						sibling->_height = red;
+						child = parent;
+						parent = parent->_parent;
+						continue;
+					}
+					if (is_black(sibling->_right)) {
+						sibling->_left->_height = black;
+						sibling->_height = red;
+						sibling = tree_rotation::rotate_right(sibling, header);
+					}
+					sibling->_height = parent->_height;
+					parent->_height = black;
+					sibling->_right->_height = black;
+					tree_rotation::rotate_left(parent, header);
+				}
+				else {
+					Node sibling = parent->_left;
+					if (sibling->_height == red) {
+						sibling->_height = black;
+						parent->_height = red;
+						tree_rotation::rotate_right(parent, header);
+						sibling = parent->_left;
+					}
+					if (is_black(sibling->_left) && is_black(sibling->_right)) {
+						sibling->_height = red;
+						child = parent;
+						parent = parent->_parent;
+						continue;
+					}
+					if (is_black(sibling->_left)) {
+						sibling->_right->_height = black;
+						sibling->_height = red;
+						sibling = tree_rotation::rotate_left(sibling, header);
+					}
+					sibling->_height = parent->_height;
+					parent->_height = black;
+					sibling->_left->_height = black;
+					tree_rotation::rotate_right(parent, header);
+				}
+				return;
+			}
+			if (child)
+				child->_height = black;
+		}
+	};
+}
+
+#endif
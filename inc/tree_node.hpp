@@ -0,0 +1,196 @@
+#ifndef _TREE_NODE_HPP_
+#define _TREE_NODE_HPP_
+
+#include <cstddef>
+#include "tree_balance.hpp"
+#include "tree_augment.hpp"
+#include "prefetch.hpp"
+
+namespace ft {
+
+	/*-----------------*/
+ /**	TREE:POLICY:  */
+/*-----------------*/
+
+/**	@brief Compile-time options of the tree behind ft::map, passed as its
+ *	last template parameter.
+ *	@Threaded: every node also keeps _prev/_next links to its in-order
+ *	neighbours (the header closes the ring), so iterator ++ and -- are one
+ *	pointer load instead of a walk through the tree; costs two pointers per node.
+ *	@Balance: ft::avl_balance (default) keeps the tree as short as possible,
+ *	which favours lookups; ft::red_black_balance does O(1) rotations per
+ *	update, which favours insert/erase heavy tables (see tree_balance.hpp).
+ *	@Augment: what every node also summarises of its subtree: nothing by
+ *	default, ft::order_statistics for subtree sizes, which turns on the map's
+ *	nth(), rank(), count_range() and O(log n) distance (see tree_augment.hpp). */
+	template <bool Threaded = false, class Balance = ft::avl_balance, class Augment = ft::no_augment>
+	struct tree_policy {
+		static const bool threaded = Threaded;
+		typedef Balance		balance_type;
+		typedef Augment		augment_type;
+	};
+
+	/*-----------------*/
+ /**	NODE:LINKS:    */
+/*-----------------*/
+
+/**	@brief Base of TNode holding the in-order stepping for the chosen policy;
+ *	the map calls thread()/unthread() when it links or unlinks a node,
+ *	those are no-ops on plain nodes */
+	template <class Node, bool Threaded>
+	struct node_links {
+
+		static Node* increment(Node* node) { return Node::tree_increment(node); }
+		static Node* decrement(Node* node) { return Node::tree_decrement(node); }
+
+		static void reset(Node*) {}
+		static void thread(Node*, Node*, bool) {}
+		static void unthread(Node*) {}
+		static void rethread(Node*) {}
+	};
+
+	template <class Node>
+	struct node_links<Node, true> {
+
+		Node*	_prev;
+		Node*	_next;
+
+		node_links() : _prev(NULL), _next(NULL) {}
+
+		static Node* increment(Node* node) { return node->_next; }
+		static Node* decrement(Node* node) { return node->_prev; }
+
+	/** empty ring: the header is its own neighbour */
+		static void reset(Node* header) {
+			header->_prev = header;
+			header->_next = header;
+		}
+
+	/** splices a new leaf next to the parent it was hung from:
+	 *	a left child comes right before its parent, a right child right after */
+		static void thread(Node* node, Node* parent, bool left) {
+			if (left) {
+				node->_next = parent;
+				node->_prev = parent->_prev;
+			}
+			else {
+				node->_prev = parent;
+				node->_next = parent->_next;
+			}
+			node->_prev->_next = node;
+			node->_next->_prev = node;
+		}
+
+		static void unthread(Node* node) {
+			node->_prev->_next = node->_next;
+			node->_next->_prev = node->_prev;
+		}
+
+	/** rebuilds the whole ring walking the tree (after a copy) */
+		static void rethread(Node* header) {
+			Node* prev = header;
+			for (Node* node = header->_left; node != header; node = Node::tree_increment(node)) {
+				node->_prev = prev;
+				prev->_next = node;
+				prev = node;
+			}
+			prev->_next = header;
+			header->_prev = prev;
+		}
+	};
+
+	/*----------*/
+ /**	NODE:  */
+/*----------*/
+
+/**	@brief Nodes of the tree. Empty children are NULL; the root's parent is
+ *	the header node, whose _parent is the root, _left the leftmost node and
+ *	_right the rightmost one. The header is recognised by its _height of -1,
+ *	which is how a bare node pointer can step in and out of end().
+ *	_height is whatever the balancing policy keeps per node: the subtree
+ *	height for AVL, the colour for red-black. Augmented data comes from the
+ *	second base, is refreshed by pull() and, if lazy, handed down by push(). */
+	template <class T, class Policy = tree_policy<> >
+ 	struct TNode : public node_links<TNode<T, Policy>, Policy::threaded>,
+								 public Policy::augment_type::template node_data<TNode<T, Policy> > {
+
+		typedef T																		value_type;
+		typedef TNode*															Node;
+		typedef node_links<TNode, Policy::threaded>	links_type;
+		typedef typename Policy::augment_type::template node_data<TNode>	augment_data;
+		typedef std::size_t													size_type;
+		typedef std::ptrdiff_t											difference_type;
+
+		value_type	_data;
+		Node				_left;
+		Node				_right;
+		Node				_parent;
+		int					_height;
+
+		TNode(const value_type& data, Node left, Node right, Node parent, int height)	:
+		_data(data), _left(left), _right(right), _parent(parent), _height(height){}
+
+		bool is_header() const { return _height < 0; }
+
+		void pull() { augment_data::pull(this); }
+		void push() { augment_data::push(this); }
+
+	/** lazy augments: has every ancestor of 'node' hand down what it owes,
+	 *	from the root, so the node's own data is exact */
+		static void settle(Node node) {
+			if (augment_data::lazy && !node->is_header())
+				_push_from_root(node->_parent);
+		}
+
+		static void _push_from_root(Node node) {
+			if (node->is_header())
+				return;
+			_push_from_root(node->_parent);
+			augment_data::push(node);
+		}
+
+		static Node minimum(Node node) {
+			while (node->_left != NULL)
+				node = node->_left;
+			return node;
+		}
+
+		static Node maximum(Node node) {
+			while (node->_right != NULL)
+				node = node->_right;
+			return node;
+		}
+
+	/** @tree_increment: next node in order; the last node steps onto the header.
+	 *	When climbing from the root we land on the header: its _right is the
+	 *	rightmost node, which tells a one-node climb from a finished one. */
+		static Node tree_increment(Node node) {
+			if (node->_right != NULL)
+				return minimum(node->_right);
+			Node parent = node->_parent;
+			while (node == parent->_right) {
+				node = parent;
+				parent = parent->_parent;
+			}
+			if (node->_right != parent)
+				node = parent;
+			return node;
+		}
+
+	/** @tree_decrement: previous node in order; the header steps onto the rightmost node */
+		static Node tree_decrement(Node node) {
+			if (node->is_header())
+				return node->_right;
+			if (node->_left != NULL)
+				return maximum(node->_left);
+			Node parent = node->_parent;
+			while (node == parent->_left) {
+				node = parent;
+				parent = parent->_parent;
+			}
+			return parent;
+		}
+	};
+}
+
+#endif
@@ -11,6 +11,20 @@
 #include <set>
 #include <map>
 #include "../containers/map.hpp"
+#include "../containers/compact_map.hpp"
+#include "../containers/btree_map.hpp"
+#include "../containers/flat_map.hpp"
+#include "../containers/frozen_map.hpp"
+#include "../containers/persistent_map.hpp"
+#include "../containers/sharded_map.hpp"
+#include "../containers/concurrent_skiplist_map.hpp"
+#include "../containers/rcu_map.hpp"
+#include "../containers/lsm_map.hpp"
+#include "../containers/art_map.hpp"
+#include "../containers/prefix_map.hpp"
+#include "../containers/unordered_map.hpp"
+#include "../containers/unordered_set.hpp"
+#include "../inc/string_view.hpp"
 #include <stdlib.h>
 #include <assert.h>
 #include "../inc/pair.hpp"
@@ -10,6 +10,8 @@
 #include <iterator>
 #include <ctime>
 #include <iomanip>
+#include <set>
+#include <algorithm>
 #include <unistd.h>
 #include <signal.h>
 #include <sys/time.h>
@@ -390,6 +392,13 @@ void test_vector_iterators(void) {
 		std::cout << *(it - 0).base() << std::endl;
 		std::cout << *(it - 1).base() << std::endl;
 	}
+	{
+		say("Rev iterators over a pointer", YELLOW);
+		std::string words[3] = {"one", "two", "three"};
+		ft::reverse_iterator<std::string*> rit(words + 3);
+
+		std::cout << rit->length() << ' ' << (++rit)->c_str() << std::endl;
+	}
 	{
 		// const int size = 5;
 		// container::vector<int> vct(size);
@@ -919,6 +928,45 @@ void test_map_iterators() {
   		for (rit=mymap.rbegin(); rit!=mymap.rend(); ++rit)
     		std::cout << rit->first << " => " << rit->second << '\n';
 	}
+	{
+		say("***********************", RED);
+		say("* Map iterator layout *", RED);
+		say("***********************", RED);
+		container::map<int,int> mymap;
+
+		for (int i = 0; i < 5; i++)
+			mymap[i] = i * 10;
+
+		// stepping back from end() goes through the header
+		container::map<int,int>::iterator it = mymap.end();
+		while (it != mymap.begin()) {
+			--it;
+			std::cout << it->first << " => " << it->second << '\n';
+		}
+		container::map<int,int>::const_iterator cit = it;
+		std::cout << "const_iterator == iterator: " << (cit == it ? "YES" : "NO") << '\n';
+		std::cout << "iterator is pointer sized: " << (sizeof(it) == sizeof(void*) ? "YES" : "NO") << '\n';
+	}
+	{
+		say("****************************", RED);
+		say("* Map threaded tree policy *", RED);
+		say("****************************", RED);
+		typedef ft::map<int, int, std::less<int>,
+										std::allocator<ft::pair<const int, int> >, ft::tree_policy<true> > threaded_map;
+		threaded_map mymap;
+
+		for (int i = 0; i < 10; i++)
+			mymap[(i * 7) % 10] = i;
+		mymap.erase(3);
+		mymap.erase(mymap.begin());
+
+		threaded_map copy(mymap);
+		for (threaded_map::iterator it = copy.begin(); it != copy.end(); ++it)
+			std::cout << it->first << " => " << it->second << '\n';
+		for (threaded_map::reverse_iterator rit = copy.rbegin(); rit != copy.rend(); ++rit)
+			std::cout << rit->first << ' ';
+		std::cout << '\n';
+	}
 }
 
 void test_map_capacity() {
@@ -970,6 +1018,54 @@ void test_map_capacity() {
 		else
 			std::cout << "The map could not hold 1000 elements.\n";
 	}
+	{
+		say("*****************************", RED);
+		say("* Map reserve and node pool *", RED);
+		say("*****************************", RED);
+		typedef ft::map<int, int, std::less<int>, ft::node_pool_allocator<ft::pair<const int, int> > > pool_map;
+		pool_map mymap;
+
+		mymap.reserve(100);
+		for (int i = 0; i < 100; i++)
+			mymap[i] = i;
+		for (int i = 0; i < 100; i += 2)
+			mymap.erase(i);
+		for (int i = 0; i < 100; i += 2)
+			mymap[i] = -i;		// recycled from the free list
+
+		pool_map copy(mymap);
+		copy.swap(mymap);
+		std::cout << "size: " << mymap.size() << " first: " << mymap.begin()->second
+							<< " last: " << mymap.rbegin()->second << '\n';
+
+		// rebinds share the pool group: the allocator given is the one owning the nodes
+		pool_map::allocator_type	pool;
+		pool_map									owned(std::less<int>(), pool);
+		owned[1] = 1;
+		std::cout << "get_allocator owns the nodes: " << (owned.get_allocator() == pool ? "YES" : "NO")
+							<< " node slab from the group: " << (pool_map::node_allocator_type(pool).capacity() != 0 ? "YES" : "NO") << '\n';
+	}
+	{
+		say("***********************", RED);
+		say("* Map arena allocator *", RED);
+		say("***********************", RED);
+		typedef ft::arena_allocator<ft::pair<const int, std::string> > arena_type;
+		typedef ft::map<int, std::string, std::less<int>, arena_type> arena_map;
+		arena_type arena(1 << 12);
+
+		// both maps of the "request" draw from one region, dropped together
+		arena_map names(std::less<int>(), arena);
+		arena_map aliases(std::less<int>(), arena);
+		for (int i = 0; i < 20; i++) {
+			names[i] = std::string(i % 5 + 1, 'a' + i % 26);
+			aliases[-i] = names[i];
+		}
+		names.erase(names.begin(), names.find(15));
+		std::cout << "names: " << names.size() << " aliases: " << aliases.size()
+							<< " shared arena: " << (names.get_allocator() == aliases.get_allocator() ? "YES" : "NO") << '\n';
+		for (arena_map::iterator it = names.begin(); it != names.end(); ++it)
+			std::cout << it->first << " => " << it->second << '\n';
+	}
 }
 
 void test_map_element_access() {
@@ -1011,6 +1107,66 @@ void test_map_element_access() {
 		for (container::map<std::string,int>::iterator it=mymap.begin(); it!=mymap.end(); ++it)
 			std::cout << it->first << " => " << it->second << '\n';
 	}
+	{
+		say("*******************", RED);
+		say("* Batched lookups *", RED);
+		say("*******************", RED);
+		ft::map<int, int>	squares;
+		for (int i = 0; i < 1000; i += 2)
+			squares[i] = i * i;
+
+		int	keys[] = { 998, 3, 0, 500, 1001, 42, 41, 2, 998, -6, 250, 777 };
+		ft::vector<ft::map<int, int>::iterator>	found;
+		ft::vector<ft::map<int, int>::iterator>	sorted_found;
+		squares.find_batch(keys, keys + 12, std::back_inserter(found));
+		squares.find_batch(keys, keys + 12, std::back_inserter(sorted_found), true);
+
+		bool same = true;
+		for (int i = 0; i < 12; i++) {
+			same = same && found[i] == squares.find(keys[i]) && sorted_found[i] == found[i];
+			if (found[i] == squares.end())
+				std::cout << keys[i] << ": missing ";
+			else
+				std::cout << keys[i] << ": " << found[i]->second << ' ';
+		}
+		std::cout << "\nsame as find, sorted or not: " << (same ? "yes" : "no") << '\n';
+	}
+	{
+		say("**************************", RED);
+		say("* Transparent comparator *", RED);
+		say("**************************", RED);
+		typedef ft::map<std::string, int, ft::transparent_less>	name_map;
+		name_map		ages;
+		const char*	names[] = { "alice", "bob", "carol", "dave" };
+
+		for (int i = 0; i < 4; i++)
+			ages[names[i]] = 20 + i;
+		std::cout << "find(\"carol\"): " << ages.find("carol")->second
+							<< " count(\"eve\"): " << ages.count("eve")
+							<< " lower_bound(\"b\"): " << ages.lower_bound("b")->first
+							<< " upper_bound(\"bob\"): " << ages.upper_bound("bob")->first << '\n';
+		ages["bob"] += 10;
+		ft::string_view	dave("dave and more", 4);
+		std::cout << "find(string_view(\"dave\")): " << ages.find(dave)->second << '\n';
+		std::cout << "erase(\"alice\"): " << ages.erase("alice") << " erase(\"zoe\"): " << ages.erase("zoe")
+							<< " bob: " << ages.at("bob") << " size: " << ages.size() << '\n';
+	}
+	{
+		say("************************", RED);
+		say("* Three-way comparator *", RED);
+		say("************************", RED);
+		ft::map<std::string, int, ft::three_way_less>	words;
+		const char*	list[] = { "pear", "apple", "fig", "plum", "apple", "kiwi" };
+
+		for (int i = 0; i < 6; i++)
+			words.insert(ft::make_pair(std::string(list[i]), i));
+		for (ft::map<std::string, int, ft::three_way_less>::iterator it = words.begin(); it != words.end(); ++it)
+			std::cout << it->first << '=' << it->second << ' ';
+		std::cout << "\nfind(\"fig\"): " << words.find("fig")->second
+							<< " count(\"grape\"): " << words.count("grape")
+							<< " lower_bound(\"g\"): " << words.lower_bound("g")->first
+							<< " three_way(\"fig\", \"kiwi\") < 0: " << (ft::three_way(std::string("fig"), "kiwi") < 0) << '\n';
+	}
 }
 
 void test_map_modifiers() {
@@ -1124,6 +1280,228 @@ void test_map_modifiers() {
 		for (container::map<char,int>::iterator it=mymap.begin(); it!=mymap.end(); ++it)
 			std::cout << it->first << " => " << it->second << '\n';
 	}
+	{
+		say("************************", RED);
+		say("* Red-black tree policy *", RED);
+		say("************************", RED);
+		typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+										ft::tree_policy<false, ft::red_black_balance> > rb_map;
+		rb_map mymap;
+
+		for (int i = 0; i < 64; i++)
+			mymap[i] = i * i;
+		for (int i = 0; i < 64; i += 3)
+			mymap.erase(i);
+		mymap.erase(mymap.find(10), mymap.find(40));
+
+		rb_map copy(mymap);
+		std::cout << "size: " << copy.size() << " copy == map: " << (copy == mymap ? "YES" : "NO") << '\n';
+		for (rb_map::iterator it = copy.begin(); it != copy.end(); ++it)
+			std::cout << it->first << " => " << it->second << '\n';
+	}
+	{
+		say("********************", RED);
+		say("* Order statistics *", RED);
+		say("********************", RED);
+		typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+										ft::tree_policy<false, ft::avl_balance, ft::order_statistics> > os_map;
+		os_map mymap;
+
+		for (int i = 0; i < 1000; i++)
+			mymap[(i * 7919) % 1000] = i;
+		for (int i = 0; i < 1000; i += 3)
+			mymap.erase(i);
+
+		std::cout << "size: " << mymap.size() << " nth(0): " << mymap.nth(0)->first
+							<< " nth(100): " << mymap.nth(100)->first << " nth(size): " << (mymap.nth(mymap.size()) == mymap.end() ? "end" : "?") << '\n';
+		std::cout << "rank(151): " << mymap.rank(151) << " rank(150): " << mymap.rank(150)
+							<< " rank(end): " << mymap.rank(mymap.end()) << '\n';
+		std::cout << "count_range(100, 200): " << mymap.count_range(100, 200)
+							<< " distance: " << ft::distance(mymap.lower_bound(100), mymap.lower_bound(200)) << '\n';
+
+		os_map copy(mymap);
+		copy.erase(copy.nth(0), copy.nth(500));
+		std::cout << "after erasing the first 500: size " << copy.size() << " nth(0): " << copy.nth(0)->first
+							<< " distance(begin, end): " << ft::distance(copy.begin(), copy.end()) << '\n';
+	}
+	{
+		say("***********************", RED);
+		say("* Monoid augmentation *", RED);
+		say("***********************", RED);
+		typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+										ft::tree_policy<false, ft::avl_balance, ft::monoid_augment<ft::sum_of<long> > > > sum_map;
+		typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+										ft::tree_policy<false, ft::red_black_balance, ft::monoid_augment<ft::min_of<int> > > > min_map;
+		sum_map sums;
+		min_map mins;
+
+		for (int i = 0; i < 1000; i++) {
+			sums.insert(ft::make_pair((i * 7919) % 1000, i));
+			mins.insert(ft::make_pair((i * 7919) % 1000, i));
+		}
+		for (int i = 0; i < 1000; i += 3) {
+			sums.erase(i);
+			mins.erase(i);
+		}
+		sums.update(sums.find(101), -1000);
+		mins.update(mins.find(101), -1000);
+
+		long sum = 0;
+		int min = 1000;
+		for (sum_map::iterator it = sums.lower_bound(100); it != sums.lower_bound(200); ++it)
+			sum += it->second;
+		for (min_map::iterator it = mins.lower_bound(150); it != mins.lower_bound(900); ++it)
+			min = it->second < min ? it->second : min;
+		std::cout << "sum [100, 200): " << sums.aggregate(100, 200) << " == " << sum
+							<< " min [150, 900): " << mins.aggregate(150, 900) << " == " << min
+							<< " min [0, 1000): " << mins.aggregate(0, 1000) << '\n';
+		std::cout << "sum of all: " << sums.aggregate() << " empty range: " << sums.aggregate(500, 500) << '\n';
+	}
+	{
+		say("**********************", RED);
+		say("* Lazy range updates *", RED);
+		say("**********************", RED);
+		typedef ft::map<int, long, std::less<int>, std::allocator<ft::pair<const int, long> >,
+										ft::tree_policy<false, ft::avl_balance, ft::range_add<long> > > add_map;
+		add_map accounts;
+		long		expected[1000] = {};
+
+		for (int i = 0; i < 1000; i++) {
+			accounts.insert(ft::make_pair(i, long(i)));
+			expected[i] = i;
+		}
+		for (int i = 0; i < 50; i++) {
+			int lo = (i * 37) % 1000, hi = lo + (i * 53) % 400;
+			accounts.add(lo, hi, i - 25);
+			for (int k = lo; k < hi && k < 1000; k++)
+				expected[k] += i - 25;
+			if (i % 5 == 0)
+				accounts.erase((i * 11) % 1000);
+		}
+		accounts.update(accounts.find(999), 0);
+		expected[999] = 0;
+
+		bool same = true;
+		long sum = 0;
+		for (add_map::iterator it = accounts.begin(); it != accounts.end(); ++it) {
+			same = same && it->second == expected[it->first];
+			if (it->first >= 200 && it->first < 700)
+				sum += expected[it->first];
+		}
+		std::cout << "values match: " << (same ? "yes" : "no") << " size: " << accounts.size()
+							<< " accounts[500]: " << accounts.find(500)->second << " == " << expected[500] << '\n';
+		std::cout << "sum [200, 700): " << accounts.aggregate(200, 700) << " == " << sum
+							<< " count: " << accounts.count_range(200, 700) << '\n';
+	}
+	{
+		say("***************************", RED);
+		say("* Split, join and set ops *", RED);
+		say("***************************", RED);
+		typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+										ft::tree_policy<true, ft::red_black_balance> > rb_map;
+		ft::map<int, int>	evens, threes, high;
+		rb_map						rb_evens, rb_threes;
+
+		for (int i = 0; i < 600; i++) {
+			if (i % 2 == 0) {
+				evens[i] = i;
+				rb_evens[i] = i;
+			}
+			if (i % 3 == 0) {
+				threes[i] = -i;
+				rb_threes[i] = -i;
+			}
+		}
+		ft::map<int, int>	both(evens);
+		ft::map<int, int>	only_evens(evens);
+		both.set_intersection(threes);
+		only_evens.set_difference(threes);
+		std::cout << "evens & threes: " << both.size() << " first: " << (++both.begin())->first
+							<< " evens - threes: " << only_evens.size() << " first: " << (++only_evens.begin())->first << '\n';
+
+		evens.set_union(threes);
+		rb_evens.set_union(rb_threes);
+		std::cout << "evens | threes: " << evens.size() << " == " << rb_evens.size()
+							<< " left in threes: " << threes.size() << " evens[3]: " << evens[3] << " evens[6]: " << evens[6] << '\n';
+
+		evens.split(300, high);
+		std::cout << "split at 300: " << evens.size() << " below, " << high.size() << " from "
+							<< high.begin()->first << " to " << (--high.end())->first << '\n';
+		evens.join(high);
+		int previous = -1;
+		bool sorted = true;
+		for (ft::map<int, int>::iterator it = evens.begin(); it != evens.end(); ++it) {
+			sorted = sorted && previous < it->first;
+			previous = it->first;
+		}
+		std::cout << "joined back: " << evens.size() << " sorted: " << (sorted ? "yes" : "no")
+							<< " high empty: " << (high.empty() ? "yes" : "no") << '\n';
+	}
+	{
+		say("***************************************", RED);
+		say("* Split, join and union across arenas *", RED);
+		say("***************************************", RED);
+		typedef ft::arena_allocator<ft::pair<const int, int> > arena_type;
+		typedef ft::map<int, int, std::less<int>, arena_type> arena_map;
+		arena_map	high(std::less<int>(), arena_type(1 << 12));
+		arena_map	odds(std::less<int>(), arena_type(1 << 12));
+
+		for (int i = 1; i < 100; i += 2)
+			odds[i] = i;
+		{
+			// the elements must leave this arena before it is dropped
+			arena_map	numbers(std::less<int>(), arena_type(1 << 12));
+			for (int i = 0; i < 100; i++)
+				numbers[i] = -i;
+			numbers.split(60, high);
+			odds.set_union(numbers);
+		}
+		std::cout << "split off: " << high.size() << " from " << high.begin()->first
+							<< " union: " << odds.size() << " odds[1]: " << odds[1] << " odds[2]: " << odds[2] << '\n';
+
+		ft::map<int, int, std::less<int>, ft::node_pool_allocator<ft::pair<const int, int> > >	low, rest;
+		for (int i = 0; i < 10; i++) {
+			low[i] = i;
+			rest[i + 10] = i;
+		}
+		low.join(rest);
+		std::cout << "joined pools: " << low.size() << " last: " << low.rbegin()->first
+							<< " rest empty: " << (rest.empty() ? "yes" : "no") << '\n';
+	}
+	{
+		say("*******************************", RED);
+		say("* Node extraction and merging *", RED);
+		say("*******************************", RED);
+		ft::map<int, std::string>	source, target;
+		source[1] = "one";
+		source[2] = "two";
+		source[3] = "three";
+		target[3] = "drei";
+
+		const std::string* where = &source[2];
+		ft::map<int, std::string>::node_handle nh = source.extract(2);
+		std::cout << "extracted: " << nh.key() << " => " << nh.mapped() << " source size: " << source.size() << '\n';
+		nh.key() = 20;
+		ft::map<int, std::string>::insert_return_type r = target.insert(nh);
+		std::cout << "inserted: " << r.inserted << " at " << r.position->first << " => " << r.position->second
+							<< " same element: " << (&r.position->second == where ? "yes" : "no")
+							<< " handle empty: " << nh.empty() << '\n';
+
+		r = target.insert(source.extract(source.find(3)));
+		std::cout << "duplicate inserted: " << r.inserted << " kept: " << r.position->second
+							<< " handed back: " << r.node.key() << " => " << r.node.mapped() << '\n';
+		std::cout << "missing key gives an empty handle: " << source.extract(42).empty() << '\n';
+
+		source[3] = "three";
+		target.merge(source);
+		std::cout << "after merge target:";
+		for (ft::map<int, std::string>::iterator it = target.begin(); it != target.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << " source:";
+		for (ft::map<int, std::string>::iterator it = source.begin(); it != source.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << '\n';
+	}
 }
 
 void test_map_non_member_functions() {
@@ -1145,6 +1523,787 @@ void test_map_non_member_functions() {
 	if (foo>=bar) std::cout << "foo is greater than or equal to bar\n";
 }
 
+void test_compact_map() {
+	say("***************", RED);
+	say("* Compact map *", RED);
+	say("***************", RED);
+	typedef ft::compact_map<int, std::string> compact_type;
+	compact_type mymap;
+
+	mymap.reserve(32);
+	for (int i = 0; i < 32; i++)
+		mymap[(i * 13) % 32] = std::string(i % 3 + 1, 'a' + i % 26);
+	compact_type::iterator last = mymap.find(31);
+	for (int i = 0; i < 32; i += 3)
+		mymap.erase(i);
+	mymap[100] = "reused slot";
+
+	compact_type copy(mymap);
+	std::cout << "size: " << copy.size() << " last still valid: " << last->first
+						<< " lower_bound(10): " << copy.lower_bound(10)->first
+						<< " upper_bound(31): " << copy.upper_bound(31)->second << '\n';
+	for (compact_type::reverse_iterator rit = copy.rbegin(); rit != copy.rend(); ++rit)
+		std::cout << rit->first << ' ';
+	std::cout << '\n';
+	std::cout << "node smaller than ft::map's: "
+						<< (sizeof(ft::CNode<ft::pair<const int, int> >) < sizeof(ft::TNode<ft::pair<const int, int> >) ? "YES" : "NO") << '\n';
+
+	std::string& held = mymap[100];
+	for (int i = 1000; i < 3000; i++)
+		mymap[i] = "grown";
+	copy = mymap;
+	std::cout << "reference kept through growth: " << held << " assigned size: " << copy.size()
+						<< " copy[2999]: " << copy[2999] << '\n';
+
+	// hints right before the key (end() going up, the previous one going
+	// down), then a wrong one and one on a key already there
+	compact_type	hinted;
+	for (int i = 0; i < 100; i++)
+		hinted.insert(hinted.end(), ft::make_pair(i * 2, std::string("up")));
+	compact_type::iterator hint = hinted.find(0);
+	for (int i = 0; i < 50; i++)
+		hint = hinted.insert(hint, ft::make_pair(-1 - 2 * i, std::string("down")));
+	hinted.insert(hinted.begin(), ft::make_pair(51, std::string("wrong hint")));
+	compact_type::iterator kept = hinted.insert(hinted.find(52), ft::make_pair(50, std::string("taken")));
+	bool sorted = true;
+	int prev = -1000;
+	for (compact_type::iterator it = hinted.begin(); it != hinted.end(); ++it) {
+		sorted = sorted && prev < it->first;
+		prev = it->first;
+	}
+	std::cout << "hinted size: " << hinted.size() << " in order: " << (sorted ? "YES" : "NO")
+						<< " [51]: " << hinted[51] << " kept: " << kept->second << '\n';
+}
+
+void test_btree_map() {
+	say("**************", RED);
+	say("* B+tree map *", RED);
+	say("**************", RED);
+	typedef ft::btree_map<int, int> btree_type;
+	btree_type mymap;
+
+	for (int i = 0; i < 1000; i++)
+		mymap[(i * 7919) % 1000] = i;
+	for (int i = 0; i < 1000; i += 2)
+		mymap.erase(i);
+	mymap.erase(mymap.lower_bound(100), mymap.upper_bound(899));
+
+	btree_type copy(mymap);
+	ft::pair<btree_type::iterator, btree_type::iterator> range = copy.equal_range(51);
+	std::cout << "size: " << copy.size() << " equal_range(51): " << range.first->first
+						<< " .. " << range.second->first << " copy == map: " << (copy == mymap ? "YES" : "NO") << '\n';
+	for (btree_type::iterator it = copy.begin(); it != copy.lower_bound(20); ++it)
+		std::cout << it->first << ' ';
+	for (btree_type::reverse_iterator rit = copy.rbegin(); rit != copy.rend() && rit->first > 980; ++rit)
+		std::cout << rit->first << ' ';
+	std::cout << '\n';
+
+	ft::btree_map<std::string, std::string> words;
+	words["leaf"] = "chained";
+	words["inner"] = "routes";
+	words["root"] = "grows up";
+	for (ft::btree_map<std::string, std::string>::const_iterator it = words.begin(); it != words.end(); ++it)
+		std::cout << it->first << " => " << it->second << '\n';
+}
+
+void test_flat_map() {
+	say("************", RED);
+	say("* Flat map *", RED);
+	say("************", RED);
+	typedef ft::flat_map<int, int> flat_type;
+	flat_type mymap;
+	ft::map<int, int> tree;
+
+	ft::vector<ft::pair<int, int> > batch;
+	for (int i = 0; i < 1000; i++)
+		batch.push_back(ft::make_pair((i * 7919) % 1500, i));
+	mymap.insert(batch.begin(), batch.end());
+	tree.insert(batch.begin(), batch.end());
+	for (int i = 0; i < 1500; i += 3) {
+		mymap.erase(i);
+		tree.erase(i);
+	}
+	mymap.insert(batch.rbegin(), batch.rend());
+	tree.insert(batch.rbegin(), batch.rend());
+	mymap.erase(mymap.lower_bound(100), mymap.upper_bound(899));
+	tree.erase(tree.lower_bound(100), tree.upper_bound(899));
+
+	bool same = mymap.size() == tree.size();
+	ft::map<int, int>::iterator mit = tree.begin();
+	for (flat_type::iterator it = mymap.begin(); same && it != mymap.end(); ++it, ++mit)
+		same = it->first == mit->first && it->second == mit->second;
+	std::cout << "size: " << mymap.size() << " same as ft::map: " << (same ? "YES" : "NO")
+						<< " find(1497): " << mymap.find(1497)->second << " == " << tree.find(1497)->second << '\n';
+
+	mymap.reserve(2000);
+	std::cout << "capacity >= 2000: " << (mymap.capacity() >= 2000 ? "YES" : "NO");
+	mymap.shrink_to_fit();
+	std::cout << " after shrink_to_fit: " << mymap.capacity() << '\n';
+
+	flat_type copy(mymap);
+	copy[50] = -1;
+	std::cout << "copy < map: " << (copy < mymap ? "YES" : "NO") << " lower_bound(50): " << copy.lower_bound(50)->second
+						<< " upper_bound(50): " << copy.upper_bound(50)->first << '\n';
+	for (flat_type::const_reverse_iterator rit = copy.rbegin(); rit != copy.rend() && rit->first > 1480; ++rit)
+		std::cout << rit->first << ' ';
+	std::cout << '\n';
+}
+
+void test_unordered_map() {
+	say("*****************", RED);
+	say("* Unordered map *", RED);
+	say("*****************", RED);
+	typedef ft::unordered_map<int, int> hash_type;
+	hash_type mymap;
+	ft::map<int, int> tree;
+
+	mymap.reserve(1000);
+	std::size_t buckets = mymap.bucket_count();
+	for (int i = 0; i < 1000; i++) {
+		mymap[(i * 7919) % 1500] = i;
+		tree[(i * 7919) % 1500] = i;
+	}
+	for (int i = 0; i < 1500; i += 3) {
+		mymap.erase(i);
+		tree.erase(i);
+	}
+	for (hash_type::iterator it = mymap.begin(); it != mymap.end(); )
+		if (it->second % 2)
+			mymap.erase(it++);
+		else
+			++it;
+	for (ft::map<int, int>::iterator it = tree.begin(); it != tree.end(); )
+		if (it->second % 2)
+			tree.erase(it++);
+		else
+			++it;
+
+	bool same = mymap.size() == tree.size();
+	for (ft::map<int, int>::iterator it = tree.begin(); same && it != tree.end(); ++it)
+		same = mymap.count(it->first) && mymap.at(it->first) == it->second;
+	std::cout << "size: " << mymap.size() << " same as ft::map: " << (same ? "YES" : "NO")
+						<< " no rehash after reserve(1000): " << (mymap.bucket_count() == buckets ? "YES" : "NO") << '\n';
+
+	hash_type copy(mymap);
+	copy.rehash(0);
+	std::cout << "copy == map: " << (copy == mymap ? "YES" : "NO") << " load factor <= "
+						<< copy.max_load_factor() << ": " << (copy.load_factor() <= copy.max_load_factor() ? "YES" : "NO") << '\n';
+
+	ft::unordered_map<std::string, ft::pair<int, int> > words;
+	words["swiss"] = ft::make_pair(16, 7);
+	words["table"] = ft::make_pair(1, 2);
+	ft::unordered_set<ft::pair<int, int> > seen;
+	seen.insert(words["swiss"]);
+	seen.insert(words["table"]);
+	seen.insert(ft::make_pair(16, 7));
+	std::cout << "words: " << words.size() << " distinct pairs: " << seen.size()
+						<< " find(\"table\"): " << words.find("table")->second.first << '\n';
+}
+
+void test_frozen_map() {
+	say("**************", RED);
+	say("* Frozen map *", RED);
+	say("**************", RED);
+	typedef ft::frozen_map<int, int> frozen_type;
+	ft::map<int, int> tree;
+
+	for (int i = 0; i < 1000; i++)
+		tree[(i * 7919) % 1500] = i;
+	frozen_type frozen = tree.freeze();
+
+	bool same = frozen.size() == tree.size();
+	ft::map<int, int>::iterator mit = tree.begin();
+	for (frozen_type::const_iterator it = frozen.begin(); same && it != frozen.end(); ++it, ++mit)
+		same = it->first == mit->first && it->second == mit->second;
+	for (int k = -1; same && k <= 1500; k++)
+		same = frozen.count(k) == tree.count(k)
+				&& (frozen.lower_bound(k) == frozen.end() ? tree.lower_bound(k) == tree.end()
+																									: frozen.lower_bound(k)->first == tree.lower_bound(k)->first)
+				&& (frozen.upper_bound(k) == frozen.end() ? tree.upper_bound(k) == tree.end()
+																									: frozen.upper_bound(k)->first == tree.upper_bound(k)->first);
+	std::cout << "size: " << frozen.size() << " same as ft::map: " << (same ? "YES" : "NO")
+						<< " find(1497): " << frozen.find(1497)->second << " at(0): " << frozen.at(0)
+						<< " root key: " << frozen.keys()[0] << '\n';
+
+	ft::vector<ft::pair<int, int> > batch;
+	for (int i = 0; i < 10; i++)
+		batch.push_back(ft::make_pair(9 - i % 5, i));
+	frozen_type small(batch.begin(), batch.end());
+	for (frozen_type::const_reverse_iterator rit = small.rbegin(); rit != small.rend(); ++rit)
+		std::cout << rit->first << '=' << rit->second << ' ';
+	try {
+		small.at(4);
+	}
+	catch (std::out_of_range& e) {
+		std::cout << "at(4): " << e.what();
+	}
+	std::cout << "\nsmall < frozen: " << (small < frozen ? "YES" : "NO")
+						<< " copy == small: " << (frozen_type(small) == small ? "YES" : "NO") << '\n';
+
+	typedef ft::arena_allocator<ft::pair<const int, int> > arena_type;
+	ft::map<int, int, std::less<int>, arena_type>	arena_tree(std::less<int>(), arena_type(1 << 12));
+	for (int i = 0; i < 100; i++)
+		arena_tree[i] = -i;
+	ft::frozen_map<int, int, std::less<int>, arena_type> arena_frozen = arena_tree.freeze();
+	std::cout << "frozen in the map's arena: " << (arena_frozen.get_allocator() == arena_tree.get_allocator() ? "YES" : "NO")
+						<< " at(99): " << arena_frozen.at(99) << '\n';
+}
+
+void test_persistent_map() {
+	say("******************", RED);
+	say("* Persistent map *", RED);
+	say("******************", RED);
+	typedef ft::persistent_map<int, std::string> persistent_type;
+	persistent_type current;
+	ft::vector<persistent_type> versions;
+
+	for (int i = 0; i < 8; i++) {
+		current.insert(ft::make_pair(i * 3 % 8, std::string(1, 'a' + i)));
+		versions.push_back(current.snapshot());
+	}
+	current.erase(0);
+	current.insert_or_assign(5, "five");
+	current.insert_or_assign(9, "nine");
+	versions.push_back(current);
+	for (ft::vector<persistent_type>::iterator v = versions.begin(); v != versions.end(); ++v) {
+		std::cout << "v" << v - versions.begin() << ":";
+		for (persistent_type::const_iterator it = v->begin(); it != v->end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << '\n';
+	}
+	persistent_type::const_iterator it = current.lower_bound(4);
+	persistent_type::const_iterator prev = it;
+	--prev;
+	std::cout << "lower_bound(4): " << it->first << " prev: " << prev->first
+						<< " count(0): " << current.count(0) << " in v7: " << versions[7].count(0)
+						<< " v7 == v8: " << (versions[7] == versions[8] ? "YES" : "NO")
+						<< " v7 < v8: " << (versions[7] < versions[8] ? "YES" : "NO") << '\n';
+	versions.clear();
+	std::cout << "after dropping the versions: size " << current.size() << " at(9): " << current.at(9) << '\n';
+}
+
+typedef ft::sharded_map<int, int, std::less<int>, 4> sharded_type;
+
+struct sharded_add {
+	int	delta;
+	sharded_add(int d) : delta(d) {}
+	void operator()(int& value) const { value += delta; }
+};
+
+/** one writer thread of the sharded map test: keys id, id + 4, id + 8... */
+void* sharded_writer(void* arg) {
+	std::pair<sharded_type*, long>* job = static_cast<std::pair<sharded_type*, long>*>(arg);
+	for (int k = job->second; k < 400; k += 4) {
+		job->first->insert(ft::make_pair(k, 0));
+		job->first->update(k, sharded_add(k));
+		if (k % 3 == 0)
+			job->first->erase(k);
+	}
+	return NULL;
+}
+
+void test_sharded_map() {
+	say("***************", RED);
+	say("* Sharded map *", RED);
+	say("***************", RED);
+	sharded_type shared;
+	pthread_t	threads[4];
+	std::pair<sharded_type*, long>	jobs[4];
+
+	for (long i = 0; i < 4; i++) {
+		jobs[i] = std::make_pair(&shared, i);
+		pthread_create(&threads[i], NULL, sharded_writer, &jobs[i]);
+	}
+	for (int i = 0; i < 4; i++)
+		pthread_join(threads[i], NULL);
+
+	int value = -1;
+	std::cout << "size: " << shared.size() << " get(10): " << shared.get(10, value) << ' ' << value
+						<< " count(9): " << shared.count(9) << " insert_or_assign(9): " << shared.insert_or_assign(9, 9)
+						<< " shard_of(10) < 4: " << (shared.shard_of(10) < sharded_type::shard_count) << '\n';
+	sharded_type::ordered_view view(shared);
+	int	shown = 0;
+	bool	ordered = true;
+	int	prev = -1;
+	for (sharded_type::const_iterator it = view.begin(); it != view.end(); ++it) {
+		if (shown++ < 8)
+			std::cout << it->first << '=' << it->second << ' ';
+		ordered = ordered && prev < it->first && it->first == it->second;
+		prev = it->first;
+	}
+	std::cout << "... in order: " << (ordered ? "YES" : "NO") << " from 390: ";
+	for (sharded_type::const_iterator it = view.lower_bound(390); it != view.end(); ++it)
+		std::cout << it->first << ' ';
+	std::cout << '\n';
+}
+
+typedef ft::concurrent_skiplist_map<int, int> skiplist_type;
+
+/** one call on a contended key, between two ticks of a shared clock: 'call'
+ *	before it starts, 'ret' after it returns, so it took effect in between.
+ *	@value: what insert wrote, or what insert and find saw (-1: absent) */
+struct skiplist_op {
+	enum kind { insert, erase, find };
+
+	int			key;
+	kind		what;
+	bool		ok;
+	int			value;
+	int			seen;
+	long		call;
+	long		ret;
+};
+
+static volatile long	skiplist_clock = 0;
+static volatile long	skiplist_writing = 0;
+
+/** the contended keys, each value unique to one insert: key << 20 | tag */
+static const int	skiplist_contended = 1000;
+static const int	skiplist_keys = 4;
+
+/** a value found under 'k' was written under 'k', and not by a freed node */
+bool skiplist_sound(int k, int v) {
+	return k < skiplist_contended ? v == k : v >> 20 == k;
+}
+
+/** one thread of the skiplist test: its own keys id, id + 4, id + 8...,
+ *	checked against what a sequential map would answer, then the contended
+ *	keys fought over by all threads, every call recorded for the
+ *	linearizability check */
+struct skiplist_job {
+	skiplist_type*						map;
+	long											id;
+	long											wrong;
+	std::vector<skiplist_op>	history;
+};
+
+void* skiplist_worker(void* arg) {
+	skiplist_job* job = static_cast<skiplist_job*>(arg);
+	for (int k = job->id; k < 400; k += 4) {
+		job->wrong += !job->map->insert(ft::make_pair(k, k)).second;
+		job->wrong += job->map->insert(ft::make_pair(k, -1)).second;
+		job->wrong += job->map->find(k) == job->map->end() || job->map->find(k)->second != k;
+		if (k % 3 == 0)
+			job->wrong += job->map->erase(k) != 1 || job->map->erase(k) != 0 || job->map->count(k) != 0;
+	}
+	for (int i = 0; i < 1500; i++) {
+		skiplist_op	op;
+		op.key = skiplist_contended + (i * 7 + job->id) % skiplist_keys;
+		op.what = skiplist_op::kind((i * 5 + job->id) % 3);
+		op.value = op.key << 20 | int(job->id << 16) | i;
+		op.seen = -1;
+		skiplist_type::guard	g(*job->map);		// keeps what insert and find return readable
+		op.call = ft::atomic_increment(&skiplist_clock);
+		if (op.what == skiplist_op::insert) {
+			ft::pair<skiplist_type::const_iterator, bool> r = job->map->insert(ft::make_pair(op.key, op.value));
+			op.ok = r.second;
+			op.seen = r.first->second;
+		}
+		else if (op.what == skiplist_op::erase)
+			op.ok = job->map->erase(op.key) == 1;
+		else {
+			skiplist_type::const_iterator it = job->map->find(op.key);
+			op.ok = it != job->map->end();
+			op.seen = op.ok ? it->second : -1;
+		}
+		op.ret = ft::atomic_increment(&skiplist_clock);
+		job->history.push_back(op);
+	}
+	ft::atomic_decrement(&skiplist_writing);
+	return NULL;
+}
+
+/** runs while the workers write: full walks and lower_bound scans must see
+ *	keys in order, each with a value written under it */
+void* skiplist_reader(void* arg) {
+	std::pair<skiplist_type*, long>* job = static_cast<std::pair<skiplist_type*, long>*>(arg);
+	for (int round = 0; ft::atomic_load(&skiplist_writing) > 0 || round < 10; round++) {
+		skiplist_type::guard	g(*job->first);
+		int	from = round % 2 ? -1 : (round * 37) % (skiplist_contended + skiplist_keys);
+		int	prev = from - 1;
+		skiplist_type::const_iterator it = from < 0 ? job->first->begin() : job->first->lower_bound(from);
+		for (; it != job->first->end(); ++it) {
+			job->second += it->first <= prev || !skiplist_sound(it->first, it->second);
+			prev = it->first;
+		}
+	}
+	return NULL;
+}
+
+/** @brief Whether the calls on one key can be put in an order that keeps
+ *	each inside its own [call, ret] and gives every recorded answer on a
+ *	single sequential map (Wing and Gong's search, with Lowe's cache of
+ *	the states already tried). The calls are a list of call and return
+ *	events in clock order: a call whose answer fits the state is taken out
+ *	with its return; reaching a return first means a taken call was wrong */
+bool skiplist_linearizable(const std::vector<skiplist_op>& ops) {
+	std::size_t							n = ops.size();
+	std::vector<std::pair<long, std::size_t> >	events;		// tick, op * 2 + (return)
+	for (std::size_t i = 0; i < n; i++) {
+		events.push_back(std::make_pair(ops[i].call, 2 * i));
+		events.push_back(std::make_pair(ops[i].ret, 2 * i + 1));
+	}
+	std::sort(events.begin(), events.end());
+	std::size_t							head = events.size();	// list of events, 'head' its sentinel
+	std::vector<std::size_t>	next(events.size() + 1), prev(events.size() + 1), slot(2 * n);
+	for (std::size_t e = 0; e <= events.size(); e++) {
+		next[e] = e + 1 > events.size() ? 0 : e + 1;
+		prev[e] = e == 0 ? head : e - 1;
+		if (e < events.size())
+			slot[events[e].second] = e;
+	}
+	next[head] = events.empty() ? head : 0;
+	prev[0] = head;
+
+	std::vector<bool>												taken(n);
+	std::set<std::pair<std::vector<bool>, int> >	tried;
+	std::vector<std::pair<std::size_t, int> >		stack;		// op taken, state before it
+	int			state = -1;		// the value under the key, -1: absent
+	std::size_t	e = next[head];
+	while (next[head] != head) {
+		std::size_t	op = events[e].second / 2;
+		if (events[e].second % 2 == 0) {
+			const skiplist_op&	c = ops[op];
+			bool	fits;
+			int		after = state;
+			if (c.what == skiplist_op::insert) {
+				fits = c.ok == (state == -1) && c.seen == (c.ok ? c.value : state);
+				after = c.ok ? c.value : state;
+			}
+			else if (c.what == skiplist_op::erase) {
+				fits = c.ok == (state != -1);
+				after = -1;
+			}
+			else
+				fits = c.seen == state;
+			if (fits) {
+				taken[op] = true;
+				if (tried.insert(std::make_pair(taken, after)).second) {
+					stack.push_back(std::make_pair(op, state));
+					state = after;
+					for (int side = 0; side < 2; side++) {		// takes out the call and its return
+						std::size_t	x = slot[2 * op + side];
+						next[prev[x]] = next[x];
+						prev[next[x]] = prev[x];
+					}
+					e = next[head];
+					continue;
+				}
+				taken[op] = false;
+			}
+			e = next[e];
+		}
+		else {
+			if (stack.empty())
+				return false;
+			op = stack.back().first;
+			state = stack.back().second;
+			stack.pop_back();
+			taken[op] = false;
+			for (int side = 1; side >= 0; side--) {		// puts them back, in reverse
+				std::size_t	x = slot[2 * op + side];
+				next[prev[x]] = x;
+				prev[next[x]] = x;
+			}
+			e = next[slot[2 * op]];
+		}
+	}
+	return true;
+}
+
+void test_concurrent_skiplist_map() {
+	say("***************************", RED);
+	say("* Concurrent skiplist map *", RED);
+	say("***************************", RED);
+	skiplist_type										shared;
+	pthread_t												threads[5];
+	skiplist_job										jobs[4];
+	std::pair<skiplist_type*, long>	reader(&shared, 0);
+
+	skiplist_writing = 4;
+	for (long i = 0; i < 4; i++) {
+		jobs[i].map = &shared;
+		jobs[i].id = i;
+		jobs[i].wrong = 0;
+		pthread_create(&threads[i], NULL, skiplist_worker, &jobs[i]);
+	}
+	pthread_create(&threads[4], NULL, skiplist_reader, &reader);
+	for (int i = 0; i < 5; i++)
+		pthread_join(threads[i], NULL);
+	long wrong = 0;
+	for (int i = 0; i < 4; i++)
+		wrong += jobs[i].wrong;
+	bool linearizable = true;
+	for (int k = skiplist_contended; k < skiplist_contended + skiplist_keys; k++) {
+		std::vector<skiplist_op>	ops;
+		for (int i = 0; i < 4; i++)
+			for (std::size_t j = 0; j < jobs[i].history.size(); j++)
+				if (jobs[i].history[j].key == k)
+					ops.push_back(jobs[i].history[j]);
+		// the final state is one more call, after all the others
+		skiplist_op	last = { k, skiplist_op::find, shared.count(k) != 0, 0, -1, skiplist_clock + 1, skiplist_clock + 2 };
+		if (last.ok)
+			last.seen = shared.find(k)->second;
+		ops.push_back(last);
+		linearizable = linearizable && skiplist_linearizable(ops);
+	}
+	std::cout << "size: " << shared.size() << " wrong answers: " << wrong
+						<< " contended histories linearizable: " << (linearizable ? "YES" : "NO")
+						<< " concurrent scans sorted and sound: " << (reader.second == 0 ? "YES" : "NO") << '\n';
+	bool	ordered = true;
+	int		prev = -1;
+	int		shown = 0;
+	for (skiplist_type::const_iterator it = shared.begin(); it != shared.end(); ++it) {
+		if (shown++ < 8)
+			std::cout << it->first << '=' << it->second << ' ';
+		ordered = ordered && prev < it->first && it->first % 3 != 0;
+		prev = it->first;
+		if (prev >= 400)
+			break;
+	}
+	std::cout << "... in order: " << (ordered ? "YES" : "NO") << " from 395: ";
+	for (skiplist_type::const_iterator it = shared.lower_bound(395); it != shared.end() && it->first < 1000; ++it)
+		std::cout << it->first << ' ';
+	std::cout << "at(10): " << shared.at(10) << " upper_bound(10): " << shared.upper_bound(10)->first << '\n';
+	shared.clear();
+	std::cout << "after clear: " << shared.size() << ' ' << shared.empty() << '\n';
+}
+
+typedef ft::rcu_map<ft::map<int, int> > rcu_type;
+
+/** adds the next key: every version holds 0 => 0, 1 => 1... size - 1 */
+struct rcu_append {
+	void operator()(ft::map<int, int>& m) const {
+		int k = m.size();
+		m[k] = k;
+	}
+};
+
+/** one reader thread of the rcu test: counts the versions it saw broken */
+void* rcu_reader(void* arg) {
+	std::pair<rcu_type*, long>* job = static_cast<std::pair<rcu_type*, long>*>(arg);
+	for (int i = 0; i < 2000; i++) {
+		rcu_type::reader r(*job->first);
+		int size = r->size();
+		if (size && (r->find(size - 1) == r->end() || r->find(size - 1)->second != size - 1 || r->count(size)))
+			job->second++;
+	}
+	return NULL;
+}
+
+void test_rcu_map() {
+	say("***********", RED);
+	say("* RCU map *", RED);
+	say("***********", RED);
+	rcu_type			table;
+	pthread_t			threads[2];
+	std::pair<rcu_type*, long>	jobs[2];
+
+	for (int i = 0; i < 2; i++) {
+		jobs[i] = std::make_pair(&table, 0L);
+		pthread_create(&threads[i], NULL, rcu_reader, &jobs[i]);
+	}
+	for (int i = 0; i < 100; i++)
+		table.update(rcu_append());
+	for (int i = 0; i < 2; i++)
+		pthread_join(threads[i], NULL);
+	std::cout << "size: " << table.size() << " broken versions seen: " << jobs[0].second + jobs[1].second << '\n';
+	{
+		rcu_type::reader	before(table);
+		table.update(rcu_append());
+		int value = -1;
+		std::cout << "reader kept: " << before->size() << " current: " << table.size()
+							<< " get(100): " << table.get(100, value) << ' ' << value
+							<< " from the kept one: " << before->count(100) << '\n';
+	}
+	table.synchronize();
+	ft::map<int, int>	routes;
+	for (int i = 0; i < 10; i++)
+		routes[i * 10] = i;
+	ft::rcu_map<ft::frozen_map<int, int> >	frozen(routes.freeze());
+	routes[5] = 42;
+	frozen.publish(routes.freeze());
+	ft::rcu_map<ft::frozen_map<int, int> >::reader	r(frozen);
+	std::cout << "frozen: " << r->size() << " at(5): " << r->at(5) << " lower_bound(31): " << r->lower_bound(31)->first << '\n';
+}
+
+void test_lsm_map() {
+	say("***********", RED);
+	say("* LSM map *", RED);
+	say("***********", RED);
+	ft::lsm_map<int, int>	log;
+	ft::map<int, int>			model;
+	log.buffer_limit(8);
+	for (int i = 0; i < 300; i++) {
+		int k = (i * 37) % 101;
+		if (i % 5 == 4) {
+			log.erase(k);
+			model.erase(k);
+		}
+		else {
+			log.insert_or_assign(k, i);
+			model[k] = i;
+		}
+	}
+	bool	same = log.size() == model.size();
+	ft::lsm_map<int, int>::const_iterator it = log.begin();
+	for (ft::map<int, int>::iterator m = model.begin(); same && m != model.end(); ++m, ++it)
+		same = it->first == m->first && it->second == m->second;
+	int value = -1;
+	std::cout << "size: " << log.size() << " runs: " << log.run_count() << " as ft::map: " << (same ? "YES" : "NO")
+						<< " insert(4): " << log.insert(ft::make_pair(4, 0)) << " insert(1000): " << log.insert(ft::make_pair(1000, 0))
+						<< " get(74): " << log.get(74, value) << ' ' << value << " count(4): " << log.count(4) << '\n';
+	log.compact();
+	std::cout << "compacted runs: " << log.run_count() << " size: " << log.size() << " from 95:";
+	for (it = log.lower_bound(95); it != log.end(); ++it)
+		std::cout << ' ' << it->first << '=' << it->second;
+	ft::lsm_map<int, int>	copy(log);
+	copy.erase(1000);
+	std::size_t runs = copy.run_count();
+	bool equal = copy == log;
+	bool less = copy < log;
+	bool hidden = copy.find(1000) == copy.end() && copy.lower_bound(999) == copy.end();
+	std::cout << "\ncopy == log: " << equal << " copy < log: " << less << " at(0): " << log.at(0)
+						<< " tombstone hides 1000: " << hidden << " reads left the runs: " << (copy.run_count() == runs ? "YES" : "NO") << '\n';
+	const ft::pair<const int, int>&	found = *log.find(95);
+	std::cout << "find(95): " << found.first << '=' << found.second
+						<< " same record as lower_bound(95): " << (&found == &*log.lower_bound(95) ? "YES" : "NO") << '\n';
+}
+
+/** a value whose copy throws while 'armed': inserts that fail half way */
+struct art_fragile {
+	static bool	armed;
+	int					value;
+
+	explicit art_fragile(int v) : value(v) {}
+	art_fragile(const art_fragile& x) : value(x.value) {
+		if (armed)
+			throw std::runtime_error("art_fragile: copy refused");
+	}
+};
+
+bool art_fragile::armed = false;
+
+void test_art_map() {
+	say("***********", RED);
+	say("* ART map *", RED);
+	say("***********", RED);
+	ft::art_map<unsigned long, int>	wide;
+	ft::map<unsigned long, int>			model;
+	for (unsigned long i = 0; i < 3000; i++) {
+		unsigned long k = (i * 2654435761UL) % 1000003 << (i % 5 * 8);
+		wide[k] = i;
+		model[k] = i;
+		if (i % 3 == 2) {
+			unsigned long gone = model.begin()->first;
+			wide.erase(gone);
+			model.erase(gone);
+		}
+	}
+	bool	same = wide.size() == model.size();
+	ft::art_map<unsigned long, int>::const_iterator it = wide.begin();
+	for (ft::map<unsigned long, int>::iterator m = model.begin(); same && m != model.end(); ++m, ++it)
+		same = it->first == m->first && it->second == m->second;
+	std::cout << "size: " << wide.size() << " as ft::map: " << (same ? "YES" : "NO")
+						<< " lower_bound(12345): " << (wide.lower_bound(12345)->first == model.lower_bound(12345)->first)
+						<< " upper_bound(max): " << (wide.upper_bound(model.rbegin()->first) == wide.end())
+						<< " find(1): " << (wide.find(1) == wide.end()) << '\n';
+	ft::art_map<int, int>	ints;
+	for (int i = -6; i <= 6; i += 3)
+		ints.insert(ft::make_pair(i * 100, i));
+	std::cout << "signed:";
+	for (ft::art_map<int, int>::reverse_iterator r = ints.rbegin(); r != ints.rend(); ++r)
+		std::cout << ' ' << r->first;
+	ft::art_map<std::string, int>	paths;
+	const char*	metrics[] = { "tenant/a/cpu", "tenant/a/cpu/user", "tenant/a/mem", "tenant/b/cpu", "tenant/ab/cpu", "tenant" };
+	for (int i = 0; i < 6; i++)
+		paths[metrics[i]] = i;
+	std::cout << "\nunder tenant/a/:";
+	ft::pair<ft::art_map<std::string, int>::iterator, ft::art_map<std::string, int>::iterator> under = paths.scan_prefix("tenant/a/");
+	for (; under.first != under.second; ++under.first)
+		std::cout << ' ' << under.first->first;
+	ft::art_map<std::string, int>	copy(paths);
+	copy.erase("tenant/a/cpu");
+	std::cout << "\ncopy == paths: " << (copy == paths) << " copy < paths: " << (copy < paths)
+						<< " count(tenant/a/cpu/user): " << copy.count("tenant/a/cpu/user") << " at(tenant): " << paths.at("tenant") << '\n';
+	paths.clear();
+	std::cout << "memory after clear: " << paths.memory() << " empty: " << paths.empty() << '\n';
+
+	// a leaf split ("metrics/cpu2"), a prefix split ("metal"), a new child ("metrics/disk")
+	ft::art_map<std::string, art_fragile>	fragile;
+	const char*	kept[] = { "metrics/cpu", "metrics/mem", "metrics/net" };
+	const char*	refused[] = { "metrics/cpu2", "metal", "metrics/disk" };
+	for (int i = 0; i < 3; i++)
+		fragile.insert(ft::make_pair(std::string(kept[i]), art_fragile(i)));
+	std::size_t	memory = fragile.memory();
+	int					thrown = 0;
+	for (int i = 0; i < 3; i++) {
+		ft::pair<const std::string, art_fragile>	val(refused[i], art_fragile(-1));
+		art_fragile::armed = true;
+		try {
+			fragile.insert(val);
+		}
+		catch (std::runtime_error&) {
+			thrown++;
+		}
+		art_fragile::armed = false;
+	}
+	bool unchanged = fragile.size() == 3 && fragile.memory() == memory && std::distance(fragile.begin(), fragile.end()) == 3;
+	for (int i = 0; i < 3; i++)
+		unchanged = unchanged && fragile.find(kept[i]) != fragile.end() && fragile.find(kept[i])->second.value == i
+								&& fragile.count(refused[i]) == 0;
+	std::cout << "failed inserts: " << thrown << " map unchanged: " << (unchanged ? "YES" : "NO") << '\n';
+}
+
+void test_prefix_map() {
+	say("**************", RED);
+	say("* Prefix map *", RED);
+	say("**************", RED);
+	ft::prefix_map<int>						paths;
+	ft::map<std::string, int>			model;
+	const char*	tenants[] = { "acme", "acme-eu", "globex" };
+	const char*	services[] = { "api", "db", "dbproxy" };
+	const char*	metrics[] = { "cpu", "cpu/user", "mem", "" };
+	for (int i = 0; i < 36; i++) {
+		std::string key = std::string(tenants[i % 3]) + "/" + services[i / 3 % 3] + "/" + metrics[i / 9];
+		paths[key] = i;
+		model[key] = i;
+	}
+	paths.erase("acme/db/cpu");
+	model.erase("acme/db/cpu");
+	paths.erase("globex/api/");
+	model.erase("globex/api/");
+	bool	same = paths.size() == model.size();
+	ft::prefix_map<int>::const_iterator it = paths.begin();
+	for (ft::map<std::string, int>::iterator m = model.begin(); same && m != model.end(); ++m, ++it)
+		same = it->first == m->first && it->second == m->second;
+	std::cout << "size: " << paths.size() << " as ft::map: " << (same ? "YES" : "NO")
+						<< " lower_bound(acme/c): " << paths.lower_bound("acme/c")->first
+						<< " upper_bound(acme/db/cpu/user): " << paths.upper_bound("acme/db/cpu/user")->first
+						<< " count(acme/db/cpu): " << paths.count("acme/db/cpu") << '\n';
+	std::cout << "under acme/db:";
+	ft::pair<ft::prefix_map<int>::iterator, ft::prefix_map<int>::iterator> under = paths.scan_prefix("acme/db");
+	for (; under.first != under.second; ++under.first)
+		std::cout << ' ' << under.first->first;
+	std::cout << "\nunder acme-eu/api/c, backwards:";
+	ft::pair<ft::prefix_map<int>::const_iterator, ft::prefix_map<int>::const_iterator> cpu = paths.scan_prefix("acme-eu/api/c");
+	while (cpu.second != cpu.first)
+		std::cout << ' ' << (--cpu.second)->first;
+	bool backwards = true;
+	ft::map<std::string, int>::reverse_iterator	m = model.rbegin();
+	for (ft::prefix_map<int>::const_reverse_iterator r = paths.rbegin(); backwards && r != paths.rend(); ++r, ++m)
+		backwards = r->first == m->first && (*r).second == m->second;
+	ft::prefix_map<int>::iterator	first = paths.begin();
+	const std::string&	key = (*first).first;		// the iterator's own key, not a copy
+	++first;
+	std::cout << "\nreverse as ft::map: " << (backwards ? "YES" : "NO")
+						<< " entry key follows its iterator: " << (key == first->first ? "YES" : "NO");
+	ft::prefix_map<int>	copy(paths);
+	copy.erase(copy.scan_prefix("globex/").first, copy.scan_prefix("globex/").second);
+	std::cout << "\ncopy: " << copy.size() << " copy == paths: " << (copy == paths) << " copy < paths: " << (copy < paths)
+						<< " at(acme/api/mem): " << paths.at("acme/api/mem") << " memory: " << (paths.memory() < model.size() * sizeof(ft::map<std::string, int>::node_type) ? "less" : "more") << " than ft::map\n";
+}
+
 int	main(void) {
 	srand(0);
 	// std::cout << "Testing Container -> " << (FT == 0 ? "std" : "ft") << std::endl;
@@ -1189,6 +2348,24 @@ int	main(void) {
 			std::cout << RED << e.what() << ENDC << std::endl;
 		}
 	}
+	{
+		try {
+			test_compact_map();
+			test_btree_map();
+			test_flat_map();
+			test_unordered_map();
+			test_frozen_map();
+			test_persistent_map();
+			test_sharded_map();
+			test_concurrent_skiplist_map();
+			test_rcu_map();
+			test_lsm_map();
+			test_art_map();
+			test_prefix_map();
+		} catch (std::exception &e) {
+			std::cout << RED << e.what() << ENDC << std::endl;
+		}
+	}
 	
 	return (0);
 }